@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/BatchPathfinder.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+/**
+ * @brief Lotes de consultas con 1 a N hilos, y la escritura directa en la memoria del hilo frente a un Path por consulta.
+ */
+void BENCH::batch() {
+    constexpr int SIZE = 256;
+    constexpr int QUERIES = 1000;
+
+    GridGraph map(SIZE, SIZE);
+    map.generateObstacles(SEED);
+    const DynamicArray<Position> pairs = connectedPairs(map, QUERIES);
+    DynamicArray<PathQuery> queries(QUERIES);
+    for (int i = 0; i < QUERIES; ++i) {
+        queries[i].src = pairs[2 * i];
+        queries[i].dest = pairs[2 * i + 1];
+        queries[i].algorithm = i % 2 == 0 ? PathAlgorithm::Bfs : PathAlgorithm::AStar;
+    }
+
+    // Un hilo: un Path temporal por consulta copiado a la memoria del hilo, frente a appendPath() sobre ella
+    Pathfinder pathfinder(map);
+    DynamicArray<Position> copied;
+    Path arena;
+    const double copyTime = bestOf(3, [&] {
+        copied.clear();
+        for (int i = 0; i < QUERIES; ++i) {
+            const Path path = pathfinder.findPath(queries[i].algorithm, queries[i].src, queries[i].dest);
+            for (int step = 0; step < path.size(); ++step) {
+                copied.push_back(path[step]);
+            }
+        }
+    });
+    const double appendTime = bestOf(3, [&] {
+        arena.clear();
+        for (int i = 0; i < QUERIES; ++i) {
+            keep(pathfinder.appendPath(queries[i].algorithm, queries[i].src, queries[i].dest, arena));
+        }
+    });
+    if (arena.size() != copied.size()) {
+        std::printf("  ERROR: appendPath y findPath guardan un número distinto de posiciones\n");
+        return;
+    }
+
+    std::printf("Lote de %d consultas (bfs y A*) en %dx%d generado, %u núcleos disponibles\n", QUERIES, SIZE, SIZE,
+                std::thread::hardware_concurrency());
+    std::printf("Un hilo: Path temporal + copia %.2f ms, appendPath %.2f ms (%d posiciones)\n", copyTime, appendTime,
+                arena.size());
+    std::printf("%-6s %10s %12s %9s %8s\n", "hilos", "ms/lote", "consultas/s", "aceleración", "robos");
+
+    const int maxThreads = static_cast<int>(std::max(4u, std::thread::hardware_concurrency()));
+    double single = 0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        BatchPathfinder batch(map, threads);
+        PathBatch results;
+        batch.findPaths(queries, results); // Reserva la memoria de los hilos fuera de la medición
+        if (results.getPositionCount() != arena.size()) {
+            std::printf("  ERROR: el lote con %d hilos guarda un número distinto de posiciones\n", threads);
+            return;
+        }
+
+        const double time = bestOf(3, [&] { batch.findPaths(queries, results); });
+        if (threads == 1) {
+            single = time;
+        }
+        std::printf("%-6d %10.2f %12.0f %9.2fx %8ld\n", threads, time, QUERIES * 1000.0 / time, single / time,
+                    batch.getStealCount());
+    }
+}
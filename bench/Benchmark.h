@@ -0,0 +1,68 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+
+/**
+ * @brief Utilidades y registro de los benchmarks de los sistemas.
+ *
+ * Cada benchmark es una función sin parámetros que imprime su propia tabla; main.cpp los enumera por
+ * nombre. Los mapas se generan con semillas fijas para que las cifras sean reproducibles.
+ */
+namespace BENCH {
+    constexpr unsigned int SEED = 7; ///< Semilla de los mapas generados.
+
+    /**
+     * @brief Mide el tiempo de una función y se queda con la repetición más rápida.
+     *
+     * @param repetitions Número de repeticiones.
+     * @param function Función a medir.
+     * @return Milisegundos de la repetición más rápida.
+     */
+    template<typename Function>
+    double bestOf(const int repetitions, Function&& function) {
+        double best = 0;
+        for (int i = 0; i < repetitions; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (i == 0 || elapsed < best) {
+                best = elapsed;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Consume un resultado para que el compilador no elimine el trabajo que lo produjo.
+     *
+     * @param value Resultado a conservar.
+     */
+    void keep(long long value);
+
+    /**
+     * @brief Elige pares de celdas accesibles y conectadas con un generador de semilla SEED.
+     *
+     * @param map Mapa con al menos dos celdas conectadas.
+     * @param count Número de pares.
+     * @return Orígenes en las posiciones pares y destinos en las impares.
+     */
+    DATA_STRUCTURES::DynamicArray<Position> connectedPairs(const GridGraph& map, int count);
+
+    // Benchmarks (uno por archivo)
+    void gridScan();
+    void neighborMasks();
+    void mapSizes();
+    void bitboards();
+    void workspaceReuse();
+    void jumpPoints();
+    void bidirectional();
+    void hierarchical();
+    void batch();
+    void blockingMask();
+    void bulletTracing();
+}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <random>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Elige pares conectados cuyo destino está a como mucho radius filas y columnas del origen.
+     */
+    DynamicArray<Position> pairsWithin(const GridGraph& map, const int radius, const int count) {
+        std::mt19937 rng(BENCH::SEED);
+        std::uniform_int_distribution<int> rowDist(0, map.getRows() - 1);
+        std::uniform_int_distribution<int> colDist(0, map.getCols() - 1);
+        std::uniform_int_distribution<int> offset(-radius, radius);
+        DynamicArray<Position> pairs;
+        while (pairs.size() < 2 * count) {
+            const Position src{rowDist(rng), colDist(rng)};
+            const Position dest{src.row + offset(rng), src.column + offset(rng)};
+            if (map.isValid(dest.row, dest.column) && !map.isObstacle(src.row, src.column)
+                && !map.isObstacle(dest.row, dest.column) && !(src == dest)
+                && map.areConnected(map.toIndex(src.row, src.column), map.toIndex(dest.row, dest.column))) {
+                pairs.push_back(src);
+                pairs.push_back(dest);
+            }
+        }
+        return pairs;
+    }
+}
+
+/**
+ * @brief BFS bidireccional frente a BFS: nodos expandidos y tiempo por consulta según la distancia entre los extremos.
+ */
+void BENCH::bidirectional() {
+    constexpr int SIZE = 1024;
+    constexpr int QUERIES = 50;
+    constexpr int RADII[] = {16, 128, SIZE};
+
+    std::printf("BFS bidireccional en %dx%d, %d pares conectados por radio: medias por consulta\n", SIZE, SIZE, QUERIES);
+    std::printf("%-9s %6s %7s %10s %10s %7s %8s %8s\n", "mapa", "radio", "pasos", "bfs exp", "bidir exp", "razón",
+                "bfs ms", "bidir ms");
+    for (const bool generated : {false, true}) {
+        GridGraph map(SIZE, SIZE);
+        if (generated) {
+            map.generateObstacles(SEED);
+        }
+        Pathfinder pathfinder(map);
+
+        for (const int radius : RADII) {
+            const DynamicArray<Position> pairs = pairsWithin(map, radius, QUERIES);
+            long long steps = 0;
+            long long bfsExpanded = 0;
+            long long bidirectionalExpanded = 0;
+            for (int i = 0; i < QUERIES; ++i) {
+                const int length = pathfinder.bfs(pairs[2 * i], pairs[2 * i + 1]).size();
+                bfsExpanded += pathfinder.getExpandedNodeCount();
+                if (pathfinder.bidirectionalBfs(pairs[2 * i], pairs[2 * i + 1]).size() != length) {
+                    std::printf("  ERROR: longitudes distintas entre bfs y bidirectionalBfs\n");
+                    return;
+                }
+                bidirectionalExpanded += pathfinder.getExpandedNodeCount();
+                steps += length - 1;
+            }
+
+            const double bfsTime = bestOf(1, [&] {
+                for (int i = 0; i < QUERIES; ++i) {
+                    keep(pathfinder.bfs(pairs[2 * i], pairs[2 * i + 1]).size());
+                }
+            });
+            const double bidirectionalTime = bestOf(1, [&] {
+                for (int i = 0; i < QUERIES; ++i) {
+                    keep(pathfinder.bidirectionalBfs(pairs[2 * i], pairs[2 * i + 1]).size());
+                }
+            });
+            std::printf("%-9s %6d %7lld %10lld %10lld %7.1f %8.3f %8.3f\n", generated ? "generado" : "abierto", radius,
+                        steps / QUERIES, bfsExpanded / QUERIES, bidirectionalExpanded / QUERIES,
+                        static_cast<double>(bfsExpanded) / bidirectionalExpanded, bfsTime / QUERIES,
+                        bidirectionalTime / QUERIES);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+#include <bit>
+#include <cstdio>
+#include <random>
+#include "Benchmark.h"
+#include "data_structures/Bitboard.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    constexpr int SHAPE_SIZE = 4; ///< Lado de la forma cuadrada de la prueba de encaje.
+
+    /**
+     * @brief Cuenta filas y columnas sin obstáculos consultando celda a celda.
+     */
+    int openLinesPerNode(const GridGraph& map) {
+        int open = 0;
+        for (int row = 0; row < map.getRows(); ++row) {
+            bool empty = true;
+            for (int col = 0; col < map.getCols() && empty; ++col) {
+                empty = !map.isObstacle(row, col);
+            }
+            open += empty;
+        }
+        for (int col = 0; col < map.getCols(); ++col) {
+            bool empty = true;
+            for (int row = 0; row < map.getRows() && empty; ++row) {
+                empty = !map.isObstacle(row, col);
+            }
+            open += empty;
+        }
+        return open;
+    }
+
+    /**
+     * @brief Cuenta filas y columnas sin obstáculos con popcount por fila y una conjunción de todas las filas.
+     */
+    int openLinesBitboard(const GridGraph& map) {
+        const Bitboard& walkable = map.getWalkableBoard();
+        int open = 0;
+        for (int row = 0; row < map.getRows(); ++row) {
+            open += walkable.rowPopcount(row) == map.getCols();
+        }
+        DynamicArray<Bitboard::Word> columns;
+        walkable.andRows(columns);
+        for (int word = 0; word < columns.size(); ++word) {
+            open += std::popcount(columns[word]);
+        }
+        return open;
+    }
+}
+
+/**
+ * @brief Pasadas de generación sobre los planos de bits frente a las consultas celda a celda.
+ */
+void BENCH::bitboards() {
+    struct Size {
+        int rows;
+        int cols;
+        bool generated;
+        int scans;
+    };
+    constexpr Size SIZES[] = {{13, 25, true, 20000}, {256, 256, true, 200}, {2000, 2000, false, 3}, {2000, 2000, true, 3}};
+    constexpr int PLACEMENTS = 200000;
+
+    std::printf("Filas/columnas sin obstáculos (ensureObstaclesInLines), microsegundos por escaneo;\n");
+    std::printf("encaje de una forma %dx%d frente a las zonas seguras, nanosegundos por intento\n", SHAPE_SIZE, SHAPE_SIZE);
+    std::printf("%-17s %12s %12s %14s %14s\n", "mapa", "líneas nodo", "líneas bits", "encaje nodo", "encaje bits");
+    for (const auto& [rows, cols, generated, scans] : SIZES) {
+        GridGraph map(rows, cols);
+        if (generated) {
+            map.generateObstacles(SEED);
+        }
+        if (openLinesPerNode(map) != openLinesBitboard(map)) {
+            std::printf("  ERROR: los recuentos de líneas no coinciden en %dx%d\n", rows, cols);
+            return;
+        }
+        const double linesNode = bestOf(3, [&] { for (int i = 0; i < scans; ++i) keep(openLinesPerNode(map)); });
+        const double linesBits = bestOf(3, [&] { for (int i = 0; i < scans; ++i) keep(openLinesBitboard(map)); });
+
+        // Posiciones de prueba fijas para ambas variantes
+        std::mt19937 rng(SEED);
+        DynamicArray<Position> bases;
+        for (int i = 0; i < PLACEMENTS; ++i) {
+            bases.push_back(Position{static_cast<int>(rng() % (rows - SHAPE_SIZE + 1)),
+                                     static_cast<int>(rng() % (cols - SHAPE_SIZE + 1))});
+        }
+        const Bitboard& safe = map.getSafeBoard();
+        auto fitsPerNode = [&](const Position base) {
+            for (int row = 0; row < SHAPE_SIZE; ++row) {
+                for (int col = 0; col < SHAPE_SIZE; ++col) {
+                    if (map.isSafeNode(map.toIndex(base.row + row, base.column + col))) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+        auto fitsBitboard = [&](const Position base) {
+            constexpr Bitboard::Word rowMask = (Bitboard::Word(1) << SHAPE_SIZE) - 1;
+            for (int row = 0; row < SHAPE_SIZE; ++row) {
+                if (safe.intersects(base.row + row, base.column, rowMask)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        long long fitNode = 0;
+        long long fitBits = 0;
+        const double placeNode = bestOf(3, [&] {
+            fitNode = 0;
+            for (int i = 0; i < PLACEMENTS; ++i) fitNode += fitsPerNode(bases[i]);
+            keep(fitNode);
+        });
+        const double placeBits = bestOf(3, [&] {
+            fitBits = 0;
+            for (int i = 0; i < PLACEMENTS; ++i) fitBits += fitsBitboard(bases[i]);
+            keep(fitBits);
+        });
+        if (fitNode != fitBits) {
+            std::printf("  ERROR: las pruebas de encaje no coinciden en %dx%d\n", rows, cols);
+            return;
+        }
+
+        char label[32];
+        std::snprintf(label, sizeof(label), "%dx%d %s", rows, cols, generated ? "generado" : "abierto");
+        std::printf("%-17s %12.2f %12.2f %14.1f %14.1f\n", label, linesNode * 1000 / scans, linesBits * 1000 / scans,
+                    placeNode * 1e6 / PLACEMENTS, placeBits * 1e6 / PLACEMENTS);
+    }
+}
@@ -0,0 +1,174 @@
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Réplica del trazado anterior de las balas: un punto en coma flotante que avanza en pasos de longitud 1.
+     */
+    Path legacyBulletPath(const GridGraph& map, const Position start, const Position end, const int maxBounces) {
+        Path path;
+
+        int bounces = 0;
+
+        double x = start.column + 0.5;
+        double y = start.row + 0.5;
+
+        double dx = end.column - start.column;
+        double dy = end.row - start.row;
+
+        // Normalizar el vector de dirección
+        double length = sqrt(dx * dx + dy * dy);
+        dx /= length;
+        dy /= length;
+
+        int gridX = static_cast<int>(x);
+        int gridY = static_cast<int>(y);
+
+        path.push_back(Position{gridY, gridX});
+
+        while (bounces <= maxBounces) {
+            x += dx;
+            y += dy;
+
+            int newGridX = static_cast<int>(x);
+            int newGridY = static_cast<int>(y);
+
+            // Verificar si cambió de celda en la cuadrícula
+            if (newGridX != gridX || newGridY != gridY) {
+                gridX = newGridX;
+                gridY = newGridY;
+
+                // Verificar límites del mapa
+                if (!map.isValid(gridY, gridX)) {
+                    // Reflexionar dirección
+                    if (gridX < 0 || gridX >= map.getCols()) {
+                        dx = -dx;
+                        x += 2 * dx;
+                        bounces++;
+                    }
+                    if (gridY < 0 || gridY >= map.getRows()) {
+                        dy = -dy;
+                        y += 2 * dy;
+                        bounces++;
+                    }
+                    if (bounces > maxBounces) {
+                        break;
+                    }
+                    continue;
+                }
+
+                Position pos{gridY, gridX};
+                path.push_back(pos);
+
+                // Verificar colisión con obstáculo
+                if (map.isObstacle(gridY, gridX)) {
+                    // Reflexionar dirección
+                    double prevX = x - dx;
+                    double prevY = y - dy;
+
+                    int prevGridX = static_cast<int>(prevX);
+                    int prevGridY = static_cast<int>(prevY);
+
+                    if (gridX != prevGridX && gridY != prevGridY) {
+                        // Colisión diagonal, reflexionar ambos ejes
+                        dx = -dx;
+                        dy = -dy;
+                    } else if (gridX != prevGridX) {
+                        dx = -dx;
+                    } else if (gridY != prevGridY) {
+                        dy = -dy;
+                    }
+                    bounces++;
+
+                    if (bounces > maxBounces) {
+                        break;
+                    }
+
+                    // Ajustar posición para evitar bucles
+                    x += dx;
+                    y += dy;
+                    continue;
+                }
+
+                // Verificar colisión con tanque
+                if (map.isOccupied(gridY, gridX)) {
+                    // La bala golpea un tanque
+                    break;
+                }
+            }
+        }
+
+        return path;
+    }
+}
+
+/**
+ * @brief Trazado de balas: rayos por segundo del trazado anterior en coma flotante frente al recorrido exacto,
+ * devolviendo un Path nuevo o reutilizando el mismo.
+ */
+void BENCH::bulletTracing() {
+    struct Size {
+        int rows;
+        int cols;
+        int rays;
+    };
+    constexpr Size SIZES[] = {{13, 25, 200000}, {32, 32, 200000}, {1024, 1024, 20000}};
+    constexpr int MAX_BOUNCES = 4;
+
+    std::printf("Trazado de balas con %d rebotes, millones de rayos por segundo\n", MAX_BOUNCES);
+    std::printf("%-10s %9s %9s %13s %14s\n", "mapa", "anterior", "exacto", "exacto reusa", "celdas/rayo");
+    for (const auto& [rows, cols, rays] : SIZES) {
+        GridGraph map(rows, cols);
+        map.generateObstacles(SEED);
+        for (int i = 0; i < 8; ++i) {
+            const Position cell = map.getRandomAccessiblePosition();
+            map.placeTank(cell.row, cell.column);
+        }
+
+        std::mt19937 rng(SEED);
+        std::uniform_int_distribution<int> rowDist(0, rows - 1);
+        std::uniform_int_distribution<int> colDist(0, cols - 1);
+        DynamicArray<Position> shots;
+        while (shots.size() < 2 * rays) {
+            const Position start{rowDist(rng), colDist(rng)};
+            const Position end{rowDist(rng), colDist(rng)};
+            if (!map.isObstacle(start.row, start.column) && !(start == end)) {
+                shots.push_back(start);
+                shots.push_back(end);
+            }
+        }
+
+        Pathfinder pathfinder(map);
+        long long cells = 0;
+        const double legacy = bestOf(3, [&] {
+            for (int i = 0; i < rays; ++i) {
+                keep(legacyBulletPath(map, shots[2 * i], shots[2 * i + 1], MAX_BOUNCES).size());
+            }
+        });
+        const double exact = bestOf(3, [&] {
+            for (int i = 0; i < rays; ++i) {
+                keep(pathfinder.calculateBulletPath(shots[2 * i], shots[2 * i + 1], MAX_BOUNCES).size());
+            }
+        });
+        Path path;
+        const double reused = bestOf(3, [&] {
+            cells = 0;
+            for (int i = 0; i < rays; ++i) {
+                pathfinder.calculateBulletPath(shots[2 * i], shots[2 * i + 1], MAX_BOUNCES, path);
+                cells += path.size();
+            }
+        });
+
+        char label[32];
+        std::snprintf(label, sizeof(label), "%dx%d", rows, cols);
+        std::printf("%-10s %9.2f %9.2f %13.2f %14.1f\n", label, rays / legacy / 1000, rays / exact / 1000,
+                    rays / reused / 1000, static_cast<double>(cells) / rays);
+    }
+}
@@ -0,0 +1,101 @@
+#include <bit>
+#include <cstdio>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Cuenta las celdas bloqueadas (obstáculo u ocupadas) con isObstacle()/isOccupied().
+     */
+    long long scanPlanes(const GridGraph& map) {
+        long long blocked = 0;
+        for (int row = 0; row < map.getRows(); ++row) {
+            for (int col = 0; col < map.getCols(); ++col) {
+                blocked += map.isObstacle(row, col) | map.isOccupied(row, col);
+            }
+        }
+        return blocked;
+    }
+
+    /**
+     * @brief Cuenta las celdas bloqueadas en la representación anterior: una fila por reserva y dos at() por celda.
+     */
+    long long scanNested(const DynamicArray<DynamicArray<Node>>& grid) {
+        long long blocked = 0;
+        for (int row = 0; row < grid.size(); ++row) {
+            for (int col = 0; col < grid[row].size(); ++col) {
+                blocked += grid[row][col].obstacle | grid[row][col].occupied;
+            }
+        }
+        return blocked;
+    }
+
+    /**
+     * @brief Cuenta las celdas bloqueadas con popcount sobre los planos de bits (64 celdas por palabra).
+     */
+    long long scanBitboards(const GridGraph& map) {
+        const Bitboard& walkable = map.getWalkableBoard();
+        const Bitboard& occupied = map.getOccupiedBoard();
+        long long free = 0;
+        for (int row = 0; row < map.getRows(); ++row) {
+            const Bitboard::Word* walkableRow = walkable.row(row);
+            const Bitboard::Word* occupiedRow = occupied.row(row);
+            for (int word = 0; word < walkable.getWordsPerRow(); ++word) {
+                free += std::popcount(walkableRow[word] & ~occupiedRow[word]);
+            }
+        }
+        return static_cast<long long>(map.getRows()) * map.getCols() - free;
+    }
+}
+
+/**
+ * @brief Escaneo completo del mapa: la cuadrícula anidada anterior frente a los planos planos y los bitboards.
+ */
+void BENCH::gridScan() {
+    struct Size {
+        int rows;
+        int cols;
+        int scans;
+    };
+    constexpr Size SIZES[] = {{13, 25, 100000}, {256, 256, 500}, {1024, 1024, 30}};
+
+    std::printf("Escaneo completo (isObstacle + isOccupied por celda), microsegundos por escaneo\n");
+    std::printf("%-11s %9s %14s %10s %10s\n", "mapa", "escaneos", "anidado+at()", "planos", "bitboards");
+    for (const auto& [rows, cols, scans] : SIZES) {
+        GridGraph map(rows, cols);
+        map.generateObstacles(SEED);
+        for (int i = 0; i < 8; ++i) {
+            const Position cell = map.getRandomAccessiblePosition();
+            map.placeTank(cell.row, cell.column);
+        }
+
+        // Réplica de la representación anterior a los planos de celdas
+        DynamicArray<DynamicArray<Node>> nested(rows);
+        for (int row = 0; row < rows; ++row) {
+            nested[row] = DynamicArray<Node>(cols);
+            for (int col = 0; col < cols; ++col) {
+                Node& node = nested[row][col];
+                node.id = map.toIndex(row, col);
+                node.obstacle = map.isObstacle(row, col);
+                node.occupied = map.isOccupied(row, col);
+            }
+        }
+
+        const long long expected = scanPlanes(map);
+        if (scanNested(nested) != expected || scanBitboards(map) != expected) {
+            std::printf("  ERROR: los recuentos no coinciden en %dx%d\n", rows, cols);
+            return;
+        }
+
+        const double nestedTime = bestOf(3, [&] { for (int i = 0; i < scans; ++i) keep(scanNested(nested)); });
+        const double planesTime = bestOf(3, [&] { for (int i = 0; i < scans; ++i) keep(scanPlanes(map)); });
+        const double bitsTime = bestOf(3, [&] { for (int i = 0; i < scans; ++i) keep(scanBitboards(map)); });
+        char label[32];
+        std::snprintf(label, sizeof(label), "%dx%d", rows, cols);
+        std::printf("%-11s %9d %14.3f %10.3f %10.3f\n", label, scans, nestedTime * 1000 / scans,
+                    planesTime * 1000 / scans, bitsTime * 1000 / scans);
+    }
+}
@@ -0,0 +1,106 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+#include "systems/HierarchicalPathfinder.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Milisegundos de una llamada.
+     */
+    template<typename Function>
+    double elapsed(Function&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+/**
+ * @brief HPA* en 1024x1024 con varios tamaños de cluster: construcción, consultas frente a BFS y A*,
+ * calidad de los caminos y reparación incremental con cellChanged() frente a reconstruir todo.
+ *
+ * Reparar y rehacer incluyen la consulta siguiente al cambio.
+ */
+void BENCH::hierarchical() {
+    constexpr int SIZE = 1024;
+    constexpr int QUERIES = 100;
+    constexpr int ROUNDS = 20;
+    constexpr int CELLS_PER_ROUND = 10;
+    constexpr int CLUSTER_SIZES[] = {8, 16, 32};
+
+    GridGraph map(SIZE, SIZE);
+    map.generateObstacles(SEED);
+    Pathfinder pathfinder(map);
+    const DynamicArray<Position> pairs = connectedPairs(map, QUERIES);
+
+    long long optimalSteps = 0;
+    for (int i = 0; i < QUERIES; ++i) {
+        optimalSteps += pathfinder.bfs(pairs[2 * i], pairs[2 * i + 1]).size() - 1;
+    }
+    const double bfsTime = bestOf(1, [&] {
+        for (int i = 0; i < QUERIES; ++i) keep(pathfinder.bfs(pairs[2 * i], pairs[2 * i + 1]).size());
+    }) / QUERIES;
+    const double aStarTime = bestOf(1, [&] {
+        for (int i = 0; i < QUERIES; ++i) keep(pathfinder.aStar(pairs[2 * i], pairs[2 * i + 1]).size());
+    }) / QUERIES;
+
+    std::printf("HPA* en %dx%d generado, %d pares conectados (bfs %.3f ms, A* %.3f ms por consulta)\n", SIZE, SIZE,
+                QUERIES, bfsTime, aStarTime);
+    std::printf("%-8s %10s %9s %9s %10s %9s %11s %11s\n", "cluster", "build ms", "entradas", "HPA* ms", "expandidos",
+                "longitud", "reparar ms", "rehacer ms");
+    for (const int clusterSize : CLUSTER_SIZES) {
+        HierarchicalPathfinder hierarchical(map, clusterSize);
+        const double build = elapsed([&] { hierarchical.build(); });
+
+        long long steps = 0;
+        long long expanded = 0;
+        for (int i = 0; i < QUERIES; ++i) {
+            steps += hierarchical.findPath(pairs[2 * i], pairs[2 * i + 1]).size() - 1;
+            expanded += hierarchical.getExpandedNodeCount();
+        }
+        const double query = bestOf(1, [&] {
+            for (int i = 0; i < QUERIES; ++i) keep(hierarchical.findPath(pairs[2 * i], pairs[2 * i + 1]).size());
+        }) / QUERIES;
+
+        // Cada ronda tapia celdas libres y las vuelve a abrir; la consulta siguiente paga la reparación
+        std::mt19937 rng(SEED);
+        std::uniform_int_distribution<int> cellDist(0, SIZE - 1);
+        double repair = 0;
+        double rebuild = 0;
+        for (int round = 0; round < ROUNDS; ++round) {
+            DynamicArray<Position> walls;
+            while (walls.size() < CELLS_PER_ROUND) {
+                const Position cell{cellDist(rng), cellDist(rng)};
+                if (!map.isObstacle(cell.row, cell.column)) {
+                    map.setNodeAccessibility(cell.row, cell.column, false);
+                    hierarchical.cellChanged(cell.row, cell.column);
+                    walls.push_back(cell);
+                }
+            }
+            const Position src = pairs[2 * round];
+            const Position dest = pairs[2 * round + 1];
+
+            repair += elapsed([&] { keep(hierarchical.findPath(src, dest).size()); });
+            rebuild += elapsed([&] {
+                hierarchical.build();
+                keep(hierarchical.findPath(src, dest).size());
+            });
+
+            for (int i = 0; i < walls.size(); ++i) {
+                map.setNodeAccessibility(walls[i].row, walls[i].column, true);
+                hierarchical.cellChanged(walls[i].row, walls[i].column);
+            }
+        }
+        hierarchical.build();
+
+        std::printf("%-8d %10.1f %9d %9.3f %10lld %8.3fx %11.3f %11.1f\n", clusterSize, build,
+                    hierarchical.getEntranceCount(), query, expanded / QUERIES,
+                    static_cast<double>(steps) / optimalSteps, repair / ROUNDS, rebuild / ROUNDS);
+    }
+}
@@ -0,0 +1,78 @@
+#include <cstdio>
+#include <random>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Resultado de una búsqueda sobre todos los pares: tiempo y nodos expandidos medios por consulta.
+     */
+    struct Measure {
+        double milliseconds;
+        double expanded;
+    };
+
+    /**
+     * @brief Mide una búsqueda de Pathfinder sobre todos los pares.
+     */
+    template<typename Search>
+    Measure measure(Pathfinder& pathfinder, const DynamicArray<Position>& pairs, Search&& search) {
+        const int count = pairs.size() / 2;
+        long long expanded = 0;
+        for (int i = 0; i < count; ++i) {
+            BENCH::keep(search(pairs[2 * i], pairs[2 * i + 1]).size());
+            expanded += pathfinder.getExpandedNodeCount();
+        }
+        const double time = BENCH::bestOf(3, [&] {
+            for (int i = 0; i < count; ++i) {
+                BENCH::keep(search(pairs[2 * i], pairs[2 * i + 1]).size());
+            }
+        });
+        return {time / count, static_cast<double>(expanded) / count};
+    }
+}
+
+/**
+ * @brief Jump Point Search en mapas abiertos y con obstáculos: JPS4 frente a BFS y JPS8 frente a A*.
+ */
+void BENCH::jumpPoints() {
+    constexpr int SIZE = 512;
+    constexpr int QUERIES = 100;
+    struct Layout {
+        const char* name;
+        double density; ///< Probabilidad de obstáculo por celda (negativa: generateObstacles()).
+    };
+    constexpr Layout LAYOUTS[] = {{"abierto", 0.0}, {"disperso 10%", 0.1}, {"disperso 25%", 0.25}, {"generado", -1}};
+
+    std::printf("Jump Point Search en %dx%d, %d pares conectados: milisegundos y nodos expandidos por consulta\n",
+                SIZE, SIZE, QUERIES);
+    std::printf("%-13s %8s %9s %8s %9s %8s %9s %8s %9s\n", "mapa", "bfs ms", "bfs exp", "JPS4 ms", "JPS4 exp",
+                "A* ms", "A* exp", "JPS8 ms", "JPS8 exp");
+    for (const auto& [name, density] : LAYOUTS) {
+        GridGraph map(SIZE, SIZE);
+        if (density < 0) {
+            map.generateObstacles(SEED);
+        } else {
+            std::mt19937 rng(SEED);
+            std::bernoulli_distribution obstacle(density);
+            for (int row = 0; row < SIZE; ++row) {
+                for (int col = 0; col < SIZE; ++col) {
+                    map.setNodeAccessibility(row, col, !obstacle(rng));
+                }
+            }
+        }
+
+        Pathfinder pathfinder(map);
+        const DynamicArray<Position> pairs = connectedPairs(map, QUERIES);
+        const auto [bfsTime, bfsExpanded] = measure(pathfinder, pairs, [&](Position s, Position d) { return pathfinder.bfs(s, d); });
+        const auto [jps4Time, jps4Expanded] = measure(pathfinder, pairs, [&](Position s, Position d) { return pathfinder.jumpPointSearch(s, d); });
+        const auto [aStarTime, aStarExpanded] = measure(pathfinder, pairs, [&](Position s, Position d) { return pathfinder.aStar(s, d); });
+        const auto [jps8Time, jps8Expanded] = measure(pathfinder, pairs, [&](Position s, Position d) { return pathfinder.jumpPointSearchDiagonal(s, d); });
+        std::printf("%-13s %8.3f %9.0f %8.3f %9.0f %8.3f %9.0f %8.3f %9.0f\n", name, bfsTime, bfsExpanded, jps4Time,
+                    jps4Expanded, aStarTime, aStarExpanded, jps8Time, jps8Expanded);
+    }
+}
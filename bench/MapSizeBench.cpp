@@ -0,0 +1,72 @@
+#include <cstdio>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+#include "systems/HierarchicalPathfinder.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Milisegundos medios por consulta de una búsqueda sobre todos los pares.
+     */
+    template<typename Search>
+    double perQuery(const DynamicArray<Position>& pairs, Search&& search) {
+        search(pairs[0], pairs[1]); // Reserva el espacio de trabajo fuera de la medición
+        const int count = pairs.size() / 2;
+        return BENCH::bestOf(1, [&] {
+            for (int i = 0; i < count; ++i) {
+                BENCH::keep(search(pairs[2 * i], pairs[2 * i + 1]).size());
+            }
+        }) / count;
+    }
+}
+
+/**
+ * @brief Barrido de tamaños de mapa: generación y cada algoritmo de búsqueda, hasta 4096x4096.
+ */
+void BENCH::mapSizes() {
+    struct Size {
+        int rows;
+        int cols;
+        int maps;
+        int queries;
+    };
+    constexpr Size SIZES[] = {{13, 25, 200, 200}, {64, 64, 50, 100}, {256, 256, 5, 20}, {1024, 1024, 1, 5},
+                              {4096, 4096, 1, 2}};
+
+    std::printf("Barrido de tamaños: generación por mapa y milisegundos medios por consulta (pares aleatorios conectados)\n");
+    std::printf("%-10s %9s %8s %8s %8s %9s %8s %8s %8s %10s %8s\n", "mapa", "generar", "bfs", "bidir", "bits",
+                "dijkstra", "A*", "JPS4", "JPS8", "HPA* build", "HPA*");
+    for (const auto& [rows, cols, maps, queries] : SIZES) {
+        const double generation = bestOf(1, [&] {
+            for (int i = 0; i < maps; ++i) {
+                GridGraph map(rows, cols);
+                map.generateObstacles(SEED + i);
+                keep(map.getFreeCellCount());
+            }
+        }) / maps;
+
+        GridGraph map(rows, cols);
+        map.generateObstacles(SEED);
+        Pathfinder pathfinder(map);
+        HierarchicalPathfinder hierarchical(map);
+        const DynamicArray<Position> pairs = connectedPairs(map, queries);
+
+        const double bfs = perQuery(pairs, [&](Position s, Position d) { return pathfinder.bfs(s, d); });
+        const double bidirectional = perQuery(pairs, [&](Position s, Position d) { return pathfinder.bidirectionalBfs(s, d); });
+        const double bits = perQuery(pairs, [&](Position s, Position d) { return pathfinder.bitParallelBfs(s, d); });
+        const double dijkstra = perQuery(pairs, [&](Position s, Position d) { return pathfinder.dijkstra(s, d); });
+        const double aStar = perQuery(pairs, [&](Position s, Position d) { return pathfinder.aStar(s, d); });
+        const double jps4 = perQuery(pairs, [&](Position s, Position d) { return pathfinder.jumpPointSearch(s, d); });
+        const double jps8 = perQuery(pairs, [&](Position s, Position d) { return pathfinder.jumpPointSearchDiagonal(s, d); });
+        const double build = bestOf(1, [&] { hierarchical.build(); });
+        const double hpa = perQuery(pairs, [&](Position s, Position d) { return hierarchical.findPath(s, d); });
+
+        char label[32];
+        std::snprintf(label, sizeof(label), "%dx%d", rows, cols);
+        std::printf("%-10s %9.3f %8.3f %8.3f %8.3f %9.3f %8.3f %8.3f %8.3f %10.1f %8.3f\n", label, generation, bfs,
+                    bidirectional, bits, dijkstra, aStar, jps4, jps8, build, hpa);
+    }
+}
@@ -0,0 +1,80 @@
+#include <cstdio>
+#include <random>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Verifica si una celda es el origen o el destino de algún par.
+     */
+    bool isEndpoint(const DynamicArray<Position>& pairs, const Position cell) {
+        for (int i = 0; i < pairs.size(); ++i) {
+            if (pairs[i] == cell) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+/**
+ * @brief Coste de la máscara de bloqueo: cada búsqueda sin máscara frente a la misma con la ocupación de los tanques.
+ */
+void BENCH::blockingMask() {
+    constexpr int SIZE = 512;
+    constexpr int QUERIES = 100;
+    constexpr int TANKS = 64;
+
+    GridGraph map(SIZE, SIZE);
+    map.generateObstacles(SEED);
+    const DynamicArray<Position> pairs = connectedPairs(map, QUERIES);
+
+    // Los tanques no ocupan ningún extremo, así que las consultas con máscara siguen teniendo destino
+    std::mt19937 rng(SEED);
+    std::uniform_int_distribution<int> cellDist(0, SIZE - 1);
+    for (int placed = 0; placed < TANKS;) {
+        const Position cell{cellDist(rng), cellDist(rng)};
+        if (!map.isObstacle(cell.row, cell.column) && !map.isOccupied(cell.row, cell.column) && !isEndpoint(pairs, cell)) {
+            map.placeTank(cell.row, cell.column);
+            ++placed;
+        }
+    }
+    const Bitboard* tanks = &map.getOccupiedBoard();
+
+    struct Algorithm {
+        const char* name;
+        Path (Pathfinder::*search)(Position, Position, const Bitboard*);
+    };
+    const Algorithm ALGORITHMS[] = {
+        {"bfs", &Pathfinder::bfs},
+        {"bidireccional", &Pathfinder::bidirectionalBfs},
+        {"bits", &Pathfinder::bitParallelBfs},
+        {"dijkstra", &Pathfinder::dijkstra},
+        {"A*", &Pathfinder::aStar},
+        {"JPS4", &Pathfinder::jumpPointSearch},
+        {"JPS8", &Pathfinder::jumpPointSearchDiagonal},
+    };
+
+    Pathfinder pathfinder(map);
+    auto perQuery = [&](auto&& search) {
+        search(pairs[0], pairs[1]); // Reserva el espacio de trabajo fuera de la medición
+        return bestOf(3, [&] {
+            for (int i = 0; i < QUERIES; ++i) {
+                keep(search(pairs[2 * i], pairs[2 * i + 1]).size());
+            }
+        }) / QUERIES;
+    };
+
+    std::printf("Máscara de bloqueo en %dx%d generado con %d tanques, %d pares: milisegundos por consulta\n", SIZE,
+                SIZE, TANKS, QUERIES);
+    std::printf("%-14s %12s %12s %11s\n", "algoritmo", "sin máscara", "con máscara", "diferencia");
+    for (const auto& [name, search] : ALGORITHMS) {
+        const double unmasked = perQuery([&](Position s, Position d) { return (pathfinder.*search)(s, d, nullptr); });
+        const double masked = perQuery([&](Position s, Position d) { return (pathfinder.*search)(s, d, tanks); });
+        std::printf("%-14s %12.3f %12.3f %+10.1f%%\n", name, unmasked, masked, (masked / unmasked - 1) * 100);
+    }
+}
@@ -0,0 +1,121 @@
+#include <cstdio>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "data_structures/LinkedList.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief BFS de longitud con arreglos planos; solo cambia cómo se recorren los vecinos.
+     *
+     * @param forEachNeighbor Llama a su argumento con cada vecino accesible de un nodo.
+     * @return Número de pasos del camino más corto, o -1 si no existe.
+     */
+    template<typename Neighbors>
+    int bfsLength(const int cells, const int start, const int goal, DynamicArray<int>& distance,
+                  DynamicArray<int>& queue, Neighbors&& forEachNeighbor) {
+        for (int i = 0; i < cells; ++i) {
+            distance[i] = -1;
+        }
+        int head = 0;
+        int tail = 0;
+        distance[start] = 0;
+        queue[tail++] = start;
+        while (head < tail) {
+            const int current = queue[head++];
+            if (current == goal) {
+                return distance[goal];
+            }
+            forEachNeighbor(current, [&](const int neighbor) {
+                if (distance[neighbor] == -1) {
+                    distance[neighbor] = distance[current] + 1;
+                    queue[tail++] = neighbor;
+                }
+            });
+        }
+        return -1;
+    }
+}
+
+/**
+ * @brief BFS de esquina a esquina: lista de adyacencia enlazada anterior frente a las máscaras de vecinos.
+ */
+void BENCH::neighborMasks() {
+    struct Size {
+        int rows;
+        int cols;
+        int queries;
+    };
+    constexpr Size SIZES[] = {{13, 25, 20000}, {256, 256, 100}, {1024, 1024, 5}};
+
+    std::printf("BFS de esquina a esquina, milisegundos por lote de consultas\n");
+    std::printf("%-11s %9s %14s %10s %16s\n", "mapa", "consultas", "LinkedList[]", "máscaras", "Pathfinder::bfs");
+    for (const auto& [rows, cols, queries] : SIZES) {
+        GridGraph map(rows, cols);
+        map.generateObstacles(SEED);
+        Pathfinder pathfinder(map);
+        const int cells = rows * cols;
+
+        // Réplica de la lista de adyacencia anterior, en el mismo orden de direcciones
+        DynamicArray<LinkedList<int>> adjacency(cells);
+        for (int id = 0; id < cells; ++id) {
+            for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+                if (map.getNeighborMask(id) & (1 << direction)) {
+                    adjacency[id].append(map.getNeighborId(id, direction));
+                }
+            }
+        }
+
+        // Primera y última celda accesibles (las esquinas de la zona de juego)
+        int start = 0;
+        while (map.isObstacle(start / cols, start % cols)) {
+            ++start;
+        }
+        int goal = cells - 1;
+        while (map.isObstacle(goal / cols, goal % cols)) {
+            --goal;
+        }
+        const Position src{start / cols, start % cols};
+        const Position dest{goal / cols, goal % cols};
+
+        DynamicArray<int> distance(cells);
+        DynamicArray<int> queue(cells);
+        auto listNeighbors = [&](const int id, auto&& visit) {
+            const LinkedList<int>& neighbors = adjacency[id];
+            for (int i = 0; i < neighbors.size(); ++i) {
+                visit(neighbors[i]);
+            }
+        };
+        auto maskNeighbors = [&](const int id, auto&& visit) {
+            const unsigned char mask = map.getNeighborMask(id);
+            for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+                if (mask & (1 << direction)) {
+                    visit(map.getNeighborId(id, direction));
+                }
+            }
+        };
+
+        const int length = bfsLength(cells, start, goal, distance, queue, maskNeighbors);
+        if (bfsLength(cells, start, goal, distance, queue, listNeighbors) != length
+            || pathfinder.bfs(src, dest).size() - 1 != length) {
+            std::printf("  ERROR: las longitudes no coinciden en %dx%d\n", rows, cols);
+            return;
+        }
+
+        const double listTime = bestOf(3, [&] {
+            for (int i = 0; i < queries; ++i) keep(bfsLength(cells, start, goal, distance, queue, listNeighbors));
+        });
+        const double maskTime = bestOf(3, [&] {
+            for (int i = 0; i < queries; ++i) keep(bfsLength(cells, start, goal, distance, queue, maskNeighbors));
+        });
+        const double pathfinderTime = bestOf(3, [&] {
+            for (int i = 0; i < queries; ++i) keep(pathfinder.bfs(src, dest).size());
+        });
+        char label[32];
+        std::snprintf(label, sizeof(label), "%dx%d", rows, cols);
+        std::printf("%-11s %9d %14.2f %10.2f %16.2f\n", label, queries, listTime, maskTime, pathfinderTime);
+    }
+}
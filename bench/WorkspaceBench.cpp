@@ -0,0 +1,88 @@
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include "Benchmark.h"
+#include "data_structures/DynamicArray.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Elige pares cercanos (como mucho 12 pasos en distancia Manhattan) de celdas accesibles y conectadas.
+     */
+    DynamicArray<Position> shortPairs(const GridGraph& map, const int count) {
+        std::mt19937 rng(BENCH::SEED);
+        std::uniform_int_distribution<int> rowDist(0, map.getRows() - 1);
+        std::uniform_int_distribution<int> colDist(0, map.getCols() - 1);
+        std::uniform_int_distribution<int> offset(-6, 6);
+        DynamicArray<Position> pairs;
+        while (pairs.size() < 2 * count) {
+            const Position src{rowDist(rng), colDist(rng)};
+            const Position dest{src.row + offset(rng), src.column + offset(rng)};
+            if (map.isValid(dest.row, dest.column) && !map.isObstacle(src.row, src.column)
+                && !map.isObstacle(dest.row, dest.column)
+                && map.areConnected(map.toIndex(src.row, src.column), map.toIndex(dest.row, dest.column))) {
+                pairs.push_back(src);
+                pairs.push_back(dest);
+            }
+        }
+        return pairs;
+    }
+
+    /**
+     * @brief Microsegundos medios por consulta sobre los primeros queries pares.
+     */
+    template<typename Search>
+    double perQuery(const DynamicArray<Position>& pairs, const int queries, Search&& search) {
+        return BENCH::bestOf(3, [&] {
+            for (int i = 0; i < queries; ++i) {
+                BENCH::keep(search(pairs[2 * i], pairs[2 * i + 1]).size());
+            }
+        }) * 1000 / queries;
+    }
+}
+
+/**
+ * @brief Consultas cortas en mapas grandes: un Pathfinder nuevo por consulta frente al espacio de trabajo reutilizado.
+ *
+ * Un Pathfinder nuevo reserva y pone a cero sus arreglos del tamaño del mapa en la primera búsqueda, que es
+ * el coste que pagaba cada acción antes del espacio de trabajo persistente. El reutilizado solo toca las
+ * celdas que explora.
+ */
+void BENCH::workspaceReuse() {
+    struct Size {
+        int rows;
+        int cols;
+        int freshQueries;
+    };
+    constexpr Size SIZES[] = {{13, 25, 2000}, {256, 256, 500}, {1024, 1024, 50}, {2000, 2000, 20}};
+    constexpr int REUSED_QUERIES = 2000;
+
+    std::printf("Consultas cortas (<= 12 pasos Manhattan), microsegundos por consulta\n");
+    std::printf("%-10s %12s %12s %16s %16s\n", "mapa", "bfs nuevo", "bfs reusado", "dijkstra nuevo", "dijkstra reusado");
+    for (const auto& [rows, cols, freshQueries] : SIZES) {
+        GridGraph map(rows, cols);
+        map.generateObstacles(SEED);
+        const DynamicArray<Position> pairs = shortPairs(map, REUSED_QUERIES);
+
+        const double bfsFresh = perQuery(pairs, freshQueries, [&](Position s, Position d) {
+            Pathfinder pathfinder(map);
+            return pathfinder.bfs(s, d);
+        });
+        const double dijkstraFresh = perQuery(pairs, freshQueries, [&](Position s, Position d) {
+            Pathfinder pathfinder(map);
+            return pathfinder.dijkstra(s, d);
+        });
+
+        Pathfinder pathfinder(map);
+        pathfinder.bfs(pairs[0], pairs[1]); // Reserva el espacio de trabajo fuera de la medición
+        const double bfsReused = perQuery(pairs, REUSED_QUERIES, [&](Position s, Position d) { return pathfinder.bfs(s, d); });
+        const double dijkstraReused = perQuery(pairs, REUSED_QUERIES, [&](Position s, Position d) { return pathfinder.dijkstra(s, d); });
+
+        char label[32];
+        std::snprintf(label, sizeof(label), "%dx%d", rows, cols);
+        std::printf("%-10s %12.2f %12.2f %16.2f %16.2f\n", label, bfsFresh, bfsReused, dijkstraFresh, dijkstraReused);
+    }
+}
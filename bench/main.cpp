@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include "Benchmark.h"
+
+namespace {
+    volatile long long sink = 0; ///< Destino de BENCH::keep().
+
+    /**
+     * @brief Benchmark registrado: nombre para la línea de comandos y función que lo ejecuta.
+     */
+    struct Entry {
+        const char* name;
+        void (*run)();
+        const char* description;
+    };
+
+    constexpr Entry BENCHMARKS[] = {
+        {"grid-scan", BENCH::gridScan, "Escaneo completo de isObstacle/isOccupied frente a la cuadrícula anidada"},
+        {"bfs-neighbors", BENCH::neighborMasks, "BFS con la lista de adyacencia enlazada frente a las máscaras de vecinos"},
+        {"map-sizes", BENCH::mapSizes, "Generación y todas las búsquedas de 13x25 a 4096x4096"},
+        {"bitboards", BENCH::bitboards, "Escaneos de líneas y encaje de formas con bitboards frente a celda a celda"},
+        {"workspace", BENCH::workspaceReuse, "Consultas cortas en mapas grandes con un Pathfinder nuevo frente al reutilizado"},
+        {"jump-points", BENCH::jumpPoints, "JPS4 frente a BFS y JPS8 frente a A* en mapas abiertos y con obstáculos"},
+        {"bidirectional", BENCH::bidirectional, "Nodos expandidos por la BFS bidireccional frente a la BFS"},
+        {"hierarchical", BENCH::hierarchical, "HPA* en 1024x1024 por tamaño de cluster, con reparación incremental"},
+        {"batch", BENCH::batch, "Lotes de consultas de 1 a N hilos y escritura directa en la memoria de cada hilo"},
+        {"mask", BENCH::blockingMask, "Cada búsqueda con y sin la máscara de ocupación de los tanques"},
+        {"bullets", BENCH::bulletTracing, "Rayos por segundo del trazado de balas anterior frente al recorrido exacto"},
+    };
+}
+
+void BENCH::keep(const long long value) {
+    sink = sink + value;
+}
+
+DATA_STRUCTURES::DynamicArray<Position> BENCH::connectedPairs(const GridGraph& map, const int count) {
+    std::mt19937 rng(SEED);
+    std::uniform_int_distribution<int> rowDist(0, map.getRows() - 1);
+    std::uniform_int_distribution<int> colDist(0, map.getCols() - 1);
+    DATA_STRUCTURES::DynamicArray<Position> pairs;
+    while (pairs.size() < 2 * count) {
+        const Position src{rowDist(rng), colDist(rng)};
+        const Position dest{rowDist(rng), colDist(rng)};
+        if (!map.isObstacle(src.row, src.column) && !map.isObstacle(dest.row, dest.column)
+            && map.areConnected(map.toIndex(src.row, src.column), map.toIndex(dest.row, dest.column))) {
+            pairs.push_back(src);
+            pairs.push_back(dest);
+        }
+    }
+    return pairs;
+}
+
+int main(const int argc, char* argv[]) {
+    if (argc == 2 && std::strcmp(argv[1], "--list") == 0) {
+        for (const Entry& entry : BENCHMARKS) {
+            std::printf("%-16s %s\n", entry.name, entry.description);
+        }
+        return 0;
+    }
+
+    // Sin argumentos se ejecutan todos los benchmarks
+    for (int arg = 1; arg < argc; ++arg) {
+        bool found = false;
+        for (const Entry& entry : BENCHMARKS) {
+            found = found || std::strcmp(argv[arg], entry.name) == 0;
+        }
+        if (!found) {
+            std::fprintf(stderr, "Benchmark desconocido: %s (usar --list)\n", argv[arg]);
+            return 1;
+        }
+    }
+
+    for (const Entry& entry : BENCHMARKS) {
+        bool selected = argc == 1;
+        for (int arg = 1; arg < argc; ++arg) {
+            selected = selected || std::strcmp(argv[arg], entry.name) == 0;
+        }
+        if (selected) {
+            entry.run();
+            std::printf("\n");
+        }
+    }
+    return 0;
+}
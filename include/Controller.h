@@ -54,7 +54,7 @@ public:
     */
     [[nodiscard]] Bullet* getBullet() const;
 
-    [[nodiscard]] DATA_STRUCTURES::LinkedList<Position> *getBulletPath() const;
+    [[nodiscard]] Path& getBulletPath() const;
 
     void handleFireBullet(Position src, Position dest) const;
 
@@ -74,6 +74,11 @@ public:
 
     void handlePowerUpActivation() const;
 
+    /**
+    * @brief Switches the BFS variant used by the Red and Yellow tanks
+    */
+    void cycleBfsMode() const;
+
     [[nodiscard]] int getRemainingTime() const;
 
     void decreaseTime() const;
@@ -83,7 +88,7 @@ public:
     /**
     * @brief Gets the path of the tank
     */
-    [[nodiscard]] DATA_STRUCTURES::LinkedList<Position> *getTankPath() const;
+    [[nodiscard]] Path& getTankPath() const;
 
     [[nodiscard]] bool getGameOver() const;
 
@@ -6,7 +6,12 @@
 #include "data_structures/Queue.h"
 #include "entities/Player.h"
 #include "entities/Tank.h"
+#include "systems/DStarLite.h"
 #include "systems/GridGraph.h"
+#include "systems/HierarchicalPathfinder.h"
+#include "systems/NextHopTable.h"
+#include "systems/PathCache.h"
+#include "systems/Pathfinder.h"
 
 
 /**
@@ -56,11 +61,29 @@ public:
     */
     void handleMoveTank(const Tank* tank, Position dest);
 
-    [[nodiscard]] DATA_STRUCTURES::LinkedList<Position>* calculatePath(Color color, POWER_UP powerUp, Position src,
-                                                                       Position dest) const;
+    [[nodiscard]] Path calculatePath(Color color, POWER_UP powerUp, Position src, Position dest) const;
 
     [[nodiscard]] int calculateProbability(Color color, POWER_UP powerUp) const;
 
+    /**
+    * @brief Selects the BFS variant used by calculatePath
+    *
+    * @param mode Queue-based BFS, bit-parallel BFS, 4-connected Jump Point Search or hierarchical search
+    */
+    void setBfsMode(BfsMode mode);
+
+    /**
+    * @brief Switches to the next BFS variant (queue, bit-parallel, Jump Point Search, hierarchical) and prints it
+    */
+    void cycleBfsMode();
+
+    [[nodiscard]] BfsMode getBfsMode() const;
+
+    /**
+    * @brief Gets the cache of deterministic searches, with its hit and miss counters
+    */
+    [[nodiscard]] const PathCache* getPathCache() const;
+
     /**
     * @brief Gets the players of the game
     */
@@ -76,7 +99,7 @@ public:
     */
     [[nodiscard]] Bullet* getBullet() const;
 
-    [[nodiscard]] DATA_STRUCTURES::LinkedList<Position>* getBulletPath() const;
+    [[nodiscard]] Path& getBulletPath();
 
     void destroyTankPath();
 
@@ -99,7 +122,7 @@ public:
     /**
     * @brief Gets the path of the tank
     */
-    [[nodiscard]] DATA_STRUCTURES::LinkedList<Position> *getTankPath() const;
+    [[nodiscard]] Path& getTankPath();
 
     /**
     * @brief Sets the current player
@@ -108,7 +131,16 @@ public:
     */
     void setCurrentPlayer(Player* player);
 
-    void moveTank(Tank* tank, Position position) const;
+    /**
+    * @brief Moves a selected tank one step along its path
+    *
+    * If another tank blocks the step, the rest of the path is repaired with the incremental planner
+    * and the tank takes the first step of the detour instead (it stops if the destination is cut off).
+    *
+    * @param tank Tank to move
+    * @param position Next position of the path
+    */
+    void moveTank(Tank* tank, Position position);
 
     void generatePowerUps() const;
 
@@ -130,15 +162,21 @@ public:
 
 private:
     GridGraph* map = nullptr; ///< Map of the game
+    Pathfinder* pathfinder = nullptr; ///< Pathfinder bound to the map; reused so its search workspace persists
+    HierarchicalPathfinder* hierarchicalPathfinder = nullptr; ///< Cluster-based near-optimal search for large maps
+    DStarLite* tankPlanner = nullptr; ///< Incremental planner that repairs the moving tank's path around other tanks
+    PathCache* pathCache = nullptr; ///< Recent bfs, dijkstra and jump point search results, flushed when the map or the tanks change
+    NextHopTable* nextHopTable = nullptr; ///< All-pairs distances and next hops of the map (invalid on large maps)
     Player* players = nullptr; ///< Array of players
     Tank* tanks = nullptr; ///< Array of tanks
     Player* currentPlayer = nullptr; ///< Current player
     Bullet* bullet = nullptr; ///< Current bullet on map
 
-    DATA_STRUCTURES::LinkedList<Position>* tankPath = nullptr; ///< Path of the tank to move
-    DATA_STRUCTURES::LinkedList<Position>* bulletPath = nullptr; ///< Path of the bullet to move
+    Path tankPath; ///< Path of the tank to move (empty when there is none)
+    Path bulletPath; ///< Path of the bullet to move (empty when there is none)
 
     int actionsRemaining = 1; ///< Actions remaining for the current player
+    BfsMode bfsMode = BfsMode::Queue; ///< BFS variant used when a tank searches with BFS
 
     int remainingTime = 300; ///< Remaining time of the game
     bool gameOver = false; ///< Indicates if the game is over
@@ -165,4 +203,48 @@ private:
     void placeTanksOnMap() const;
 
     void decreaseActions();
+
+    /**
+    * @brief Finds a shortest tank path through the path cache, with the next-hop table or a search on a miss
+    *
+    * On a miss the table is only used while it is valid and its path avoids every cell of the mask; either
+    * way the result is stored under algorithm and blocked.
+    *
+    * @param algorithm Search to run when the table is invalid or its path crosses the mask
+    * @param src Start position
+    * @param dest Destination position
+    * @param blocked Optional mask of cells the path must avoid (the start cell is never checked)
+    * @return Shortest path including src, empty if there is none
+    */
+    [[nodiscard]] Path shortestPath(PathAlgorithm algorithm, Position src, Position dest,
+                                    const DATA_STRUCTURES::Bitboard* blocked) const;
+
+    /**
+    * @brief Checks whether a path enters a masked cell after its first position
+    *
+    * @param path Path including its start position
+    * @param blocked Mask to test, or nullptr for none
+    */
+    [[nodiscard]] static bool crossesMask(const Path& path, const DATA_STRUCTURES::Bitboard* blocked);
+
+    /**
+    * @brief Runs a deterministic search through the path cache
+    *
+    * @param algorithm Search to run on a cache miss
+    * @param src Start position
+    * @param dest Destination position
+    * @param blocked Optional mask of cells the search must avoid. It is part of the cache key, so masked
+    * and unmasked searches never share an entry
+    * @return Copy of the cached or freshly computed path
+    */
+    [[nodiscard]] Path cachedSearch(PathAlgorithm algorithm, Position src, Position dest,
+                                    const DATA_STRUCTURES::Bitboard* blocked = nullptr) const;
+
+    /**
+    * @brief Replaces the rest of the tank path with a detour around other tanks
+    *
+    * @param current Current position of the moving tank
+    * @return First step of the detour, or current if the destination cannot be reached
+    */
+    Position repairTankPath(Position current);
 };
@@ -61,8 +61,6 @@ private:
 
     // Constantes
     static constexpr int CELL_SIZE = 50;             ///< Tamaño de cada celda
-    static constexpr int ROWS = 13;                  ///< Número de filas
-    static constexpr int COLS = 25;                  ///< Número de columnas
     static constexpr int X_OFFSET = 30;              ///< Desplazamiento en X
     static constexpr int Y_OFFSET = 30;              ///< Desplazamiento en Y
     static constexpr float TRACE_SIZE = CELL_SIZE * 0.25f; ///< Tamaño del rastro de la bala
@@ -273,7 +271,7 @@ private:
      * @param position Posición donde ocurrió el clic.
      * @return True si la celda está dentro de los límites.
      */
-    static bool cellClicked(Position position);
+    [[nodiscard]] bool cellClicked(Position position) const;
 
     /**
      * @brief Verifica si la bala ha golpeado un tanque.
@@ -338,8 +336,7 @@ private:
 struct MoveData {
     View* view;                ///< Puntero a la vista
     Tank* tank;                ///< Puntero al tanque
-    DATA_STRUCTURES::LinkedList<Position>* path;     ///< Ruta a seguir
-    int currentStep = 0;   ///< Paso actual en la ruta
+    Path* path;                ///< Ruta a seguir; su cursor marca el paso actual
 };
 
 struct Explosion {
@@ -0,0 +1,284 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include "DynamicArray.h"
+
+namespace DATA_STRUCTURES {
+
+/**
+ * @brief Plano de bits de rows x cols celdas, con cada fila repartida en palabras de 64 bits.
+ *
+ * La columna c de la fila r es el bit (c % 64) de la palabra (c / 64) de la fila. Los bits sobrantes
+ * de la última palabra de cada fila se mantienen siempre a 0, de modo que popcount y las comparaciones
+ * por palabra son exactas. Las filas y celdas se leen sin verificación de límites.
+ */
+class Bitboard {
+public:
+    using Word = std::uint64_t;
+    static constexpr int WORD_BITS = 64; ///< Bits por palabra.
+
+private:
+    int rows = 0;            ///< Número de filas.
+    int cols = 0;            ///< Número de columnas.
+    int wordsPerRow = 0;     ///< Palabras por fila.
+    Word lastWordMask = 0;   ///< Bits válidos de la última palabra de cada fila.
+    DynamicArray<Word> words; ///< Palabras en orden de fila mayor.
+
+public:
+    /**
+     * @brief Constructor por defecto (plano vacío de 0 x 0).
+     */
+    Bitboard() = default;
+
+    /**
+     * @brief Constructor de un plano con todas las celdas a 0.
+     * @param rows Número de filas.
+     * @param cols Número de columnas.
+     */
+    Bitboard(int rows, int cols)
+    : rows(rows), cols(cols), wordsPerRow((cols + WORD_BITS - 1) / WORD_BITS),
+      lastWordMask(cols % WORD_BITS == 0 ? ~Word(0) : (Word(1) << (cols % WORD_BITS)) - 1),
+      words(rows * ((cols + WORD_BITS - 1) / WORD_BITS)) {}
+
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    int getWordsPerRow() const { return wordsPerRow; }
+
+    /**
+     * @brief Devuelve las palabras de una fila.
+     * @param row Fila.
+     * @return Puntero a getWordsPerRow() palabras.
+     */
+    const Word* row(int row) const {
+        return words.rawData() + row * wordsPerRow;
+    }
+
+    /**
+     * @brief Devuelve las palabras de una fila para modificarlas. El llamador debe respetar los bits sobrantes.
+     * @param row Fila.
+     * @return Puntero a getWordsPerRow() palabras.
+     */
+    Word* row(int row) {
+        return words.rawData() + row * wordsPerRow;
+    }
+
+    /**
+     * @brief Consulta una celda.
+     * @param row Fila.
+     * @param col Columna.
+     * @return true si el bit está activo.
+     */
+    bool test(int row, int col) const {
+        return (words.rawData()[row * wordsPerRow + col / WORD_BITS] >> (col % WORD_BITS)) & 1;
+    }
+
+    /**
+     * @brief Activa o desactiva una celda.
+     * @param row Fila.
+     * @param col Columna.
+     * @param value Nuevo valor del bit.
+     */
+    void set(int row, int col, bool value = true) {
+        Word& word = words.rawData()[row * wordsPerRow + col / WORD_BITS];
+        const Word bit = Word(1) << (col % WORD_BITS);
+        word = value ? (word | bit) : (word & ~bit);
+    }
+
+    /**
+     * @brief Pone todas las celdas al valor indicado.
+     * @param value Valor de los bits.
+     */
+    void fill(bool value) {
+        for (int r = 0; r < rows; ++r) {
+            Word* rowWords = row(r);
+            for (int w = 0; w < wordsPerRow; ++w) {
+                rowWords[w] = value ? ~Word(0) : 0;
+            }
+            if (wordsPerRow > 0) {
+                rowWords[wordsPerRow - 1] &= lastWordMask;
+            }
+        }
+    }
+
+    /**
+     * @brief Extrae hasta 64 bits consecutivos de una fila a partir de una columna.
+     *
+     * Las columnas fuera de [0, cols) se leen como 0.
+     *
+     * @param row Fila.
+     * @param col Columna del bit 0 del resultado (puede ser negativa).
+     * @return Palabra cuyo bit i es la celda (row, col + i).
+     */
+    Word extract(int row, int col) const {
+        const Word* rowWords = this->row(row);
+        Word result = 0;
+        if (col < 0) {
+            if (col <= -WORD_BITS) {
+                return 0;
+            }
+            return wordsPerRow > 0 ? rowWords[0] << -col : 0;
+        }
+        const int index = col / WORD_BITS;
+        const int offset = col % WORD_BITS;
+        if (index < wordsPerRow) {
+            result = rowWords[index] >> offset;
+        }
+        if (offset != 0 && index + 1 < wordsPerRow) {
+            result |= rowWords[index + 1] << (WORD_BITS - offset);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Verifica si algún bit de una máscara, colocada a partir de una columna, está activo en una fila.
+     * @param row Fila.
+     * @param col Columna en la que se coloca el bit 0 de la máscara.
+     * @param mask Máscara de hasta 64 columnas.
+     * @return true si la intersección no es vacía.
+     */
+    bool intersects(int row, int col, Word mask) const {
+        return (extract(row, col) & mask) != 0;
+    }
+
+    /**
+     * @brief Cuenta los bits activos de una fila.
+     * @param row Fila.
+     * @return Número de celdas activas.
+     */
+    int rowPopcount(int row) const {
+        const Word* rowWords = this->row(row);
+        int count = 0;
+        for (int w = 0; w < wordsPerRow; ++w) {
+            count += std::popcount(rowWords[w]);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Cuenta los bits activos de todo el plano.
+     * @return Número de celdas activas.
+     */
+    int popcount() const {
+        int count = 0;
+        for (int i = 0; i < words.size(); ++i) {
+            count += std::popcount(words[i]);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Verifica si hay algún bit activo.
+     * @return true si el plano no está vacío.
+     */
+    bool any() const {
+        for (int i = 0; i < words.size(); ++i) {
+            if (words[i] != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Calcula la conjunción de todas las filas: el bit c queda activo si la columna c está activa en todas.
+     * @param out Arreglo de salida; se redimensiona a getWordsPerRow() palabras.
+     */
+    void andRows(DynamicArray<Word>& out) const {
+        out.resize(wordsPerRow);
+        for (int w = 0; w < wordsPerRow; ++w) {
+            out[w] = ~Word(0);
+        }
+        if (wordsPerRow > 0) {
+            out[wordsPerRow - 1] = lastWordMask;
+        }
+        for (int r = 0; r < rows; ++r) {
+            const Word* rowWords = row(r);
+            for (int w = 0; w < wordsPerRow; ++w) {
+                out[w] &= rowWords[w];
+            }
+        }
+    }
+
+    Bitboard& operator&=(const Bitboard& other) {
+        for (int i = 0; i < words.size(); ++i) {
+            words[i] &= other.words[i];
+        }
+        return *this;
+    }
+
+    Bitboard& operator|=(const Bitboard& other) {
+        for (int i = 0; i < words.size(); ++i) {
+            words[i] |= other.words[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Desactiva los bits activos en otro plano (this &= ~other).
+     * @param other Plano de las mismas dimensiones.
+     * @return Referencia a este plano.
+     */
+    Bitboard& andNot(const Bitboard& other) {
+        for (int i = 0; i < words.size(); ++i) {
+            words[i] &= ~other.words[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Calcula en out la vecindad 4-conexa de este plano: cada bit activo junto con sus cuatro vecinos.
+     *
+     * Los desplazamientos horizontales propagan el acarreo entre palabras de la misma fila y nunca
+     * pasan de una fila a otra.
+     *
+     * @param out Plano de las mismas dimensiones que recibe el resultado.
+     */
+    void dilateInto(Bitboard& out) const {
+        if (out.rows != rows || out.cols != cols) {
+            throw std::invalid_argument("Dimensiones de Bitboard incompatibles");
+        }
+        for (int r = 0; r < rows; ++r) {
+            const Word* center = row(r);
+            const Word* above = r > 0 ? row(r - 1) : nullptr;
+            const Word* below = r + 1 < rows ? row(r + 1) : nullptr;
+            Word* target = out.row(r);
+            for (int w = 0; w < wordsPerRow; ++w) {
+                const Word word = center[w];
+                Word result = word | (word << 1) | (word >> 1);
+                if (w > 0) {
+                    result |= center[w - 1] >> (WORD_BITS - 1);
+                }
+                if (w + 1 < wordsPerRow) {
+                    result |= center[w + 1] << (WORD_BITS - 1);
+                }
+                if (above) {
+                    result |= above[w];
+                }
+                if (below) {
+                    result |= below[w];
+                }
+                target[w] = result;
+            }
+            target[wordsPerRow - 1] &= lastWordMask;
+        }
+    }
+
+    bool operator==(const Bitboard& other) const {
+        if (rows != other.rows || cols != other.cols) {
+            return false;
+        }
+        for (int i = 0; i < words.size(); ++i) {
+            if (words[i] != other.words[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace DATA_STRUCTURES
+
+#endif // BITBOARD_H
@@ -16,7 +16,7 @@ private:
      * @brief Redimensiona el arreglo al doble de su capacidad actual.
      */
     void resize() {
-        capacity *= 2;
+        capacity = capacity > 0 ? capacity * 2 : 2;
         T* newData = new T[capacity];
 
         for (int i = 0; i < length; ++i) {
@@ -60,6 +60,32 @@ public:
         }
     }
 
+    /**
+     * @brief Constructor de movimiento: toma el búfer de other y lo deja vacío.
+     */
+    DynamicArray(DynamicArray&& other) noexcept
+    : data(other.data), capacity(other.capacity), length(other.length) {
+        other.data = nullptr;
+        other.capacity = 0;
+        other.length = 0;
+    }
+
+    /**
+     * @brief Asignación de movimiento: intercambia los búferes sin copiar elementos.
+     */
+    DynamicArray& operator=(DynamicArray&& other) noexcept {
+        if (this != &other) {
+            delete[] data;
+            data = other.data;
+            capacity = other.capacity;
+            length = other.length;
+            other.data = nullptr;
+            other.capacity = 0;
+            other.length = 0;
+        }
+        return *this;
+    }
+
     DynamicArray& operator=(const DynamicArray& other) {
         if (this != &other) {
             // Liberar la memoria actual
@@ -140,6 +166,24 @@ public:
         return data[index];
     }
 
+    /**
+     * @brief Devuelve el puntero a los elementos para recorridos sin verificación de límites.
+     *
+     * Deja de ser válido cuando el arreglo se redimensiona.
+     * @return Puntero al primer elemento.
+     */
+    T* rawData() {
+        return data;
+    }
+
+    /**
+     * @brief Devuelve el puntero a los elementos para recorridos sin verificación de límites (constante).
+     * @return Puntero constante al primer elemento.
+     */
+    const T* rawData() const {
+        return data;
+    }
+
     /**
      * @brief Obtiene el número de elementos en el arreglo.
      * @return Número de elementos.
@@ -164,13 +208,17 @@ public:
     }
 
     /**
-     * @brief Redimensiona el arreglo a una nueva capacidad.
-     * @param newCapacity Nueva capacidad deseada.
+     * @brief Cambia el número de elementos; los nuevos se inicializan con T().
+     *
+     * Si hace falta más memoria la capacidad al menos se duplica, así que hacer crecer el arreglo poco a
+     * poco con resize() cuesta O(1) amortizado por elemento, como push_back().
+     * @param newSize Nuevo número de elementos.
      */
     void resize(int newSize) {
         if (newSize > capacity) {
             // Necesitamos redimensionar y copiar los datos
-            T* newData = new T[newSize];
+            const int newCapacity = newSize > 2 * capacity ? newSize : 2 * capacity;
+            T* newData = new T[newCapacity];
             for (int i = 0; i < length; ++i) {
                 newData[i] = data[i];
             }
@@ -180,7 +228,7 @@ public:
             }
             delete[] data;
             data = newData;
-            capacity = newSize;
+            capacity = newCapacity;
         } else if (newSize > length) {
             // Solo necesitamos inicializar los nuevos elementos
             for (int i = length; i < newSize; ++i) {
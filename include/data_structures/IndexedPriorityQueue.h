@@ -0,0 +1,199 @@
+#ifndef INDEXED_PRIORITY_QUEUE_H
+#define INDEXED_PRIORITY_QUEUE_H
+
+#include "DynamicArray.h"
+
+namespace DATA_STRUCTURES {
+
+/**
+ * @brief Montículo binario mínimo de IDs en [0, capacity) con disminución de clave.
+ *
+ * Cada ID aparece como mucho una vez y guarda su posición en el montículo, así que pushOrDecrease()
+ * no inserta duplicados y update() y remove() funcionan en O(log n). clear() solo recorre los elementos
+ * que siguen dentro, por lo que reutilizar la cola entre búsquedas cortas no cuesta O(capacity).
+ *
+ * @tparam Key Tipo de la prioridad; los menores salen primero.
+ */
+template<typename Key>
+class IndexedPriorityQueue {
+private:
+    DynamicArray<int> heap;      ///< IDs en orden de montículo.
+    DynamicArray<int> position;  ///< Posición de cada ID en heap, o -1 si no está.
+    DynamicArray<Key> keys;      ///< Prioridad de cada ID (válida solo si está en la cola).
+    int count = 0;               ///< Número de elementos en la cola.
+
+    void place(const int index, const int id) {
+        heap[index] = id;
+        position[id] = index;
+    }
+
+    void siftUp(int index) {
+        const int id = heap[index];
+        const Key key = keys[id];
+        while (index > 0) {
+            const int parentIndex = (index - 1) / 2;
+            if (!(key < keys[heap[parentIndex]])) {
+                break;
+            }
+            place(index, heap[parentIndex]);
+            index = parentIndex;
+        }
+        place(index, id);
+    }
+
+    void siftDown(int index) {
+        const int id = heap[index];
+        const Key key = keys[id];
+        while (index * 2 + 1 < count) {
+            int child = index * 2 + 1;
+            if (child + 1 < count && keys[heap[child + 1]] < keys[heap[child]]) {
+                ++child;
+            }
+            if (!(keys[heap[child]] < key)) {
+                break;
+            }
+            place(index, heap[child]);
+            index = child;
+        }
+        place(index, id);
+    }
+
+public:
+    IndexedPriorityQueue() = default;
+
+    /**
+     * @brief Ajusta la cola para IDs en [0, capacity) y la vacía.
+     *
+     * Solo recorre los arreglos cuando cambia la capacidad.
+     *
+     * @param capacity Número de IDs posibles.
+     */
+    void reset(const int capacity) {
+        if (position.size() != capacity) {
+            heap.resize(capacity);
+            keys.resize(capacity);
+            position.resize(capacity);
+            for (int i = 0; i < capacity; ++i) {
+                position[i] = -1;
+            }
+            count = 0;
+        }
+        clear();
+    }
+
+    /**
+     * @brief Elimina todos los elementos en O(size()).
+     */
+    void clear() {
+        for (int i = 0; i < count; ++i) {
+            position[heap[i]] = -1;
+        }
+        count = 0;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    /**
+     * @brief Verifica si un ID está en la cola.
+     * @param id ID a consultar.
+     */
+    bool contains(const int id) const {
+        return position[id] != -1;
+    }
+
+    /**
+     * @brief Inserta un ID o, si ya está, reduce su prioridad cuando la nueva es menor.
+     * @param id ID a insertar.
+     * @param key Prioridad.
+     */
+    void pushOrDecrease(const int id, const Key& key) {
+        if (position[id] == -1) {
+            keys[id] = key;
+            place(count, id);
+            siftUp(count++);
+        } else if (key < keys[id]) {
+            keys[id] = key;
+            siftUp(position[id]);
+        }
+    }
+
+    /**
+     * @brief Inserta un ID o, si ya está, cambia su prioridad tanto si sube como si baja.
+     * @param id ID a insertar o actualizar.
+     * @param key Nueva prioridad.
+     */
+    void update(const int id, const Key& key) {
+        if (position[id] == -1) {
+            pushOrDecrease(id, key);
+            return;
+        }
+        const bool decreased = key < keys[id];
+        keys[id] = key;
+        if (decreased) {
+            siftUp(position[id]);
+        } else {
+            siftDown(position[id]);
+        }
+    }
+
+    /**
+     * @brief Elimina un ID de la cola si está.
+     * @param id ID a eliminar.
+     */
+    void remove(const int id) {
+        const int index = position[id];
+        if (index == -1) {
+            return;
+        }
+        position[id] = -1;
+        if (index == --count) {
+            return;
+        }
+        const int last = heap[count];
+        place(index, last);
+        if (index > 0 && keys[last] < keys[heap[(index - 1) / 2]]) {
+            siftUp(index);
+        } else {
+            siftDown(index);
+        }
+    }
+
+    /**
+     * @brief Devuelve el ID de menor prioridad.
+     */
+    int top() const {
+        return heap[0];
+    }
+
+    /**
+     * @brief Devuelve la prioridad de un ID que está en la cola.
+     * @param id ID a consultar.
+     */
+    const Key& getKey(const int id) const {
+        return keys[id];
+    }
+
+    /**
+     * @brief Extrae el ID de menor prioridad.
+     * @return ID extraído.
+     */
+    int pop() {
+        const int id = heap[0];
+        position[id] = -1;
+        if (--count > 0) {
+            place(0, heap[count]);
+            siftDown(0);
+        }
+        return id;
+    }
+};
+
+} // namespace DATA_STRUCTURES
+
+#endif // INDEXED_PRIORITY_QUEUE_H
@@ -1,3 +1,6 @@
+#ifndef PAIR_H
+#define PAIR_H
+
 // Definición de tu propia estructura Pair
 template<typename T1, typename T2>
 struct Pair {
@@ -23,3 +26,5 @@ struct Pair {
         return first == other.first && second == other.second;
     }
 };
+
+#endif // PAIR_H
@@ -63,5 +63,12 @@ public:
     bool empty() const {
         return heap.empty();
     }
+
+    /**
+     * @brief Elimina todos los elementos conservando la memoria reservada.
+     */
+    void clear() {
+        heap.clear();
+    }
 };
 #endif // PRIORITY_QUEUE_H
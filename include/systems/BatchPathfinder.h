@@ -0,0 +1,169 @@
+#ifndef BATCHPATHFINDER_H
+#define BATCHPATHFINDER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "GridGraph.h"
+#include "Path.h"
+#include "Pathfinder.h"
+#include "data_structures/DynamicArray.h"
+
+/**
+ * @brief Consulta de un lote: origen, destino y algoritmo.
+ */
+struct PathQuery {
+    Position src{0, 0}; ///< Posición de inicio.
+    Position dest{0, 0}; ///< Posición de destino.
+    PathAlgorithm algorithm = PathAlgorithm::Bfs; ///< Algoritmo con el que se resuelve.
+    const DATA_STRUCTURES::Bitboard* blocked = nullptr; ///< Máscara de celdas a evitar, o nullptr (solo se lee).
+};
+
+/**
+ * @brief Resultados de un lote guardados en un solo arreglo contiguo de posiciones.
+ *
+ * El camino de la consulta i ocupa las posiciones [offsets[i], offsets[i + 1]) del arreglo, en el
+ * mismo formato que devolvería Pathfinder::findPath(). Reutilizar la instancia entre lotes conserva
+ * su memoria.
+ */
+class PathBatch {
+private:
+    friend class BatchPathfinder;
+
+    DATA_STRUCTURES::DynamicArray<Position> positions; ///< Posiciones de todos los caminos, uno tras otro.
+    DATA_STRUCTURES::DynamicArray<int> offsets; ///< Inicio de cada camino en positions (size() + 1 valores).
+
+public:
+    /**
+     * @brief Devuelve el número de consultas del lote.
+     */
+    [[nodiscard]] int size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    /**
+     * @brief Devuelve la longitud del camino de una consulta (0 si no hay ruta).
+     * @param query Índice de la consulta.
+     */
+    [[nodiscard]] int getLength(const int query) const { return offsets[query + 1] - offsets[query]; }
+
+    /**
+     * @brief Accede a una posición del camino de una consulta en O(1).
+     * @param query Índice de la consulta.
+     * @param step Índice de la posición dentro del camino.
+     */
+    [[nodiscard]] const Position& at(const int query, const int step) const { return positions[offsets[query] + step]; }
+
+    /**
+     * @brief Copia el camino de una consulta en un Path.
+     * @param query Índice de la consulta.
+     */
+    [[nodiscard]] Path getPath(int query) const;
+
+    /**
+     * @brief Devuelve el número total de posiciones guardadas.
+     */
+    [[nodiscard]] int getPositionCount() const { return positions.size(); }
+};
+
+/**
+ * @brief Resuelve lotes de consultas de caminos repartiéndolas entre varios hilos.
+ *
+ * Cada hilo tiene su propio Pathfinder, así que el espacio de trabajo de cada uno se reutiliza entre
+ * consultas y entre lotes sin sincronización. Las consultas se reparten en bloques contiguos, uno por
+ * hilo; un hilo que termina el suyo roba consultas del final de los bloques de los demás, de modo que
+ * los lotes con consultas de coste muy desigual quedan equilibrados.
+ *
+ * Los hilos se crean una sola vez en el constructor y esperan en una variable de condición entre lotes;
+ * cada lote solo publica los bloques y despierta a los hilos, y el hilo que llama a findPaths() trabaja
+ * como el hilo 0.
+ *
+ * El grafo solo se lee durante un lote: no debe modificarse hasta que findPaths() termine.
+ */
+class BatchPathfinder {
+private:
+    /**
+     * @brief Estado de un hilo: su Pathfinder, su memoria de caminos y su bloque de consultas.
+     */
+    struct Worker {
+        Pathfinder pathfinder; ///< Buscador propio del hilo.
+        Path arena; ///< Caminos que resolvió el hilo, uno tras otro; Pathfinder::appendPath() escribe en él.
+        std::atomic<unsigned long long> range{0}; ///< Bloque sin reclamar: primera consulta en los 32 bits altos, fin en los bajos.
+
+        explicit Worker(GridGraph& graph) : pathfinder(graph) {}
+    };
+
+    GridGraph& graph; ///< Mapa sobre el que se busca.
+    std::vector<std::unique_ptr<Worker>> workers; ///< Un estado por hilo.
+    DATA_STRUCTURES::DynamicArray<int> owner; ///< Hilo que resolvió cada consulta.
+    DATA_STRUCTURES::DynamicArray<int> localStart; ///< Inicio del camino de cada consulta en la memoria de su hilo.
+    DATA_STRUCTURES::DynamicArray<int> lengths; ///< Longitud del camino de cada consulta.
+    std::atomic<long> steals{0}; ///< Consultas robadas en el último lote.
+
+    // Hilos persistentes (los hilos 1..n-1; el hilo 0 es el que llama a findPaths())
+    std::vector<std::thread> threads; ///< Hilos del grupo, vivos mientras viva el resolvedor.
+    std::mutex mutex; ///< Protege el estado del lote compartido con los hilos.
+    std::condition_variable wake; ///< Avisa a los hilos de un lote nuevo o del cierre.
+    std::condition_variable finished; ///< Avisa a findPaths() de que todos los hilos terminaron el lote.
+    const DATA_STRUCTURES::DynamicArray<PathQuery>* batch = nullptr; ///< Consultas del lote en curso.
+    unsigned long batchNumber = 0; ///< Número del último lote publicado.
+    int running = 0; ///< Hilos del grupo que aún no terminaron el lote en curso.
+    bool stopping = false; ///< true cuando el destructor pide a los hilos que terminen.
+
+    /**
+     * @brief Reclama la siguiente consulta del bloque propio o, si está vacío, roba una de otro hilo.
+     * @return Índice de la consulta, o -1 si no queda ninguna.
+     */
+    int claim(int self);
+
+    /**
+     * @brief Bucle de un hilo: resuelve consultas hasta que no queda ninguna.
+     */
+    void work(int self, const DATA_STRUCTURES::DynamicArray<PathQuery>& queries);
+
+    /**
+     * @brief Bucle de un hilo del grupo: espera cada lote, lo resuelve y avisa al terminar.
+     */
+    void serve(int self);
+
+public:
+    /**
+     * @brief Constructor del resolvedor de lotes.
+     *
+     * @param graph Mapa sobre el que se busca.
+     * @param threadCount Número de hilos (0 para usar todos los núcleos disponibles).
+     */
+    explicit BatchPathfinder(GridGraph& graph, int threadCount = 0);
+
+    /**
+     * @brief Detiene y espera a los hilos del grupo.
+     */
+    ~BatchPathfinder();
+
+    BatchPathfinder(const BatchPathfinder&) = delete;
+    BatchPathfinder& operator=(const BatchPathfinder&) = delete;
+
+    /**
+     * @brief Resuelve un lote de consultas.
+     *
+     * Antes de despertar a los hilos calcula las cachés perezosas del grafo que usan las búsquedas
+     * (componentes conexas), para que durante el lote solo haya lecturas.
+     *
+     * @param queries Consultas a resolver.
+     * @param results Resultados, en el mismo orden que queries.
+     */
+    void findPaths(const DATA_STRUCTURES::DynamicArray<PathQuery>& queries, PathBatch& results);
+
+    /**
+     * @brief Devuelve el número de hilos.
+     */
+    [[nodiscard]] int getThreadCount() const;
+
+    /**
+     * @brief Devuelve el número de consultas que un hilo robó a otro en el último lote.
+     */
+    [[nodiscard]] long getStealCount() const;
+};
+
+#endif // BATCHPATHFINDER_H
@@ -0,0 +1,150 @@
+#ifndef DSTARLITE_H
+#define DSTARLITE_H
+
+#include <limits>
+#include "GridGraph.h"
+#include "Path.h"
+#include "data_structures/DynamicArray.h"
+#include "data_structures/IndexedPriorityQueue.h"
+
+/**
+ * @brief Planificador incremental D* Lite 4-conexo para el movimiento de un tanque.
+ *
+ * A diferencia de Pathfinder, trata como bloqueadas las celdas ocupadas por otros tanques (la celda de
+ * inicio, donde está el propio tanque, nunca lo está). La búsqueda va del destino hacia el inicio, así
+ * que cuando el tanque avanza solo cambia el inicio y el estado de la búsqueda sigue siendo válido.
+ *
+ * Cuando una celda cambia de accesibilidad u ocupación, cellChanged() la anota y la siguiente llamada a
+ * getPath() repara solo los nodos cuyas distancias dependían de ella, en lugar de buscar desde cero.
+ * Si el mapa cambió sin avisar, getPath() vuelve a planificar desde el inicio actual.
+ */
+class DStarLite {
+private:
+    static constexpr int INF = std::numeric_limits<int>::max() / 4; ///< Distancia de los nodos no alcanzados.
+
+    const GridGraph& graph; ///< Mapa sobre el que se planifica.
+    int startId = -1; ///< Celda actual del tanque.
+    int goalId = -1; ///< Celda de destino, o -1 si no hay plan.
+    int lastStartId = -1; ///< Inicio con el que se calcularon las claves (para el ajuste keyModifier).
+    int keyModifier = 0; ///< Suma de las heurísticas de los desplazamientos del inicio (km en D* Lite).
+
+    DATA_STRUCTURES::DynamicArray<int> g; ///< Distancia al destino calculada (válida si stamp coincide).
+    DATA_STRUCTURES::DynamicArray<int> rhs; ///< Distancia al destino prevista por los sucesores (válida si stamp coincide).
+    DATA_STRUCTURES::DynamicArray<unsigned int> stamp; ///< Plan en el que se tocó cada nodo.
+    unsigned int generation = 0; ///< Plan actual; los nodos con otra marca valen INF.
+    DATA_STRUCTURES::IndexedPriorityQueue<long long> open; ///< Nodos inconsistentes ordenados por clave.
+
+    DATA_STRUCTURES::DynamicArray<int> changedCells; ///< Celdas avisadas con cellChanged() pendientes de aplicar.
+    unsigned long syncedVersion = 0; ///< Suma de las versiones de mapa y ocupación con la que el plan está al día.
+    int expandedNodes = 0; ///< Nodos expandidos por la última planificación o reparación.
+
+    /**
+     * @brief Verifica si una celda bloquea el paso (obstáculo u ocupada por otro tanque).
+     */
+    [[nodiscard]] bool isBlocked(int id) const;
+
+    /**
+     * @brief Devuelve la distancia Manhattan entre dos celdas.
+     */
+    [[nodiscard]] int heuristic(int a, int b) const;
+
+    /**
+     * @brief Devuelve la suma de las versiones de mapa y ocupación del grafo.
+     */
+    [[nodiscard]] unsigned long graphVersion() const;
+
+    /**
+     * @brief Devuelve g de un nodo en el plan actual (INF si no se ha tocado).
+     */
+    [[nodiscard]] int getG(int id) const;
+
+    /**
+     * @brief Devuelve rhs de un nodo en el plan actual (INF si no se ha tocado).
+     */
+    [[nodiscard]] int getRhs(int id) const;
+
+    /**
+     * @brief Marca un nodo como parte del plan actual, con g y rhs a INF si no lo estaba.
+     */
+    void touch(int id);
+
+    /**
+     * @brief Calcula la clave de un nodo: (min(g, rhs) + h(inicio, nodo) + km, min(g, rhs)) empaquetada en 64 bits.
+     */
+    [[nodiscard]] long long calculateKey(int id) const;
+
+    /**
+     * @brief Recalcula rhs de un nodo a partir de sus sucesores y lo coloca o lo quita de la cola.
+     */
+    void updateVertex(int id);
+
+    /**
+     * @brief Procesa nodos inconsistentes hasta que el inicio es consistente y tiene la menor clave.
+     */
+    void computeShortestPath();
+
+    /**
+     * @brief Empieza un plan nuevo hacia goalId desde startId.
+     */
+    void restart();
+
+public:
+    /**
+     * @brief Constructor del planificador (sin plan hasta que se llama a plan()).
+     *
+     * @param graph Mapa sobre el que se planifica.
+     */
+    explicit DStarLite(const GridGraph& graph);
+
+    /**
+     * @brief Empieza un plan nuevo, descartando el anterior.
+     *
+     * @param start Posición actual del tanque.
+     * @param goal Posición de destino.
+     */
+    void plan(Position start, Position goal);
+
+    /**
+     * @brief Verifica si hay un plan en curso hacia un destino.
+     *
+     * @param goal Posición de destino.
+     */
+    [[nodiscard]] bool isPlanning(Position goal) const;
+
+    /**
+     * @brief Actualiza la posición del tanque sin descartar el plan.
+     *
+     * @param start Nueva posición del tanque.
+     */
+    void moveStart(Position start);
+
+    /**
+     * @brief Anota que una celda cambió de accesibilidad u ocupación para repararla en el siguiente getPath().
+     *
+     * Debe llamarse una vez por cada cambio efectivo de setNodeAccessibility(), placeTank() o removeTank().
+     *
+     * @param row Fila de la celda.
+     * @param col Columna de la celda.
+     */
+    void cellChanged(int row, int col);
+
+    /**
+     * @brief Repara el plan con los cambios pendientes y devuelve el camino actual.
+     *
+     * @return Camino desde la posición del tanque hasta el destino en el formato de Pathfinder::bfs()
+     * (vacío si no hay plan o si el destino no es alcanzable).
+     */
+    Path getPath();
+
+    /**
+     * @brief Descarta el plan en curso.
+     */
+    void clear();
+
+    /**
+     * @brief Devuelve el número de nodos expandidos por la última planificación o reparación.
+     */
+    [[nodiscard]] int getExpandedNodeCount() const;
+};
+
+#endif // DSTARLITE_H
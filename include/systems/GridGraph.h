@@ -2,12 +2,16 @@
 #define GRIDGRAPH_H
 
 #include <iostream>
+#include <random>
 #include "Position.h"
 #include "data_structures/DynamicArray.h"
-#include "data_structures/LinkedList.h"
+#include "data_structures/Pair.h"
+#include "data_structures/Bitboard.h"
 
 /**
  * @brief Clase que representa un nodo individual en la cuadrícula del grafo.
+ *
+ * Es una copia de solo lectura: el estado real vive en los planos de celdas de GridGraph.
  */
 class Node {
 public:
@@ -22,8 +26,9 @@ public:
      *
      * @param id Identificador único del nodo.
      * @param accessible Indica si el nodo es accesible (true por defecto).
+     * @param occupied Indica si el nodo está ocupado (false por defecto).
      */
-    Node(int id, bool accessible = true);
+    Node(int id, bool accessible = true, bool occupied = false);
 };
 
 /**
@@ -31,22 +36,111 @@ public:
  */
 class GridGraph {
 private:
-    // Constantes
-    static constexpr int rows = 13; ///< Número predefinido de filas en la cuadrícula.
-    static constexpr int cols = 25; ///< Número predefinido de columnas en la cuadrícula.
+    // Dimensiones
+    int rows; ///< Número de filas en la cuadrícula.
+    int cols; ///< Número de columnas en la cuadrícula.
 
     // Miembros privados
-    DATA_STRUCTURES::DynamicArray<DATA_STRUCTURES::DynamicArray<Node>> grid;  ///< Matriz que contiene los nodos del grafo.
-    DATA_STRUCTURES::DynamicArray<DATA_STRUCTURES::LinkedList<int>> adjList; ///< Lista de adyacencia para representar conexiones entre nodos.
+    DATA_STRUCTURES::DynamicArray<unsigned char> walkable;  ///< Plano de accesibilidad en orden de fila mayor (1 si es accesible).
+    DATA_STRUCTURES::DynamicArray<unsigned char> occupied;  ///< Plano de ocupación en orden de fila mayor (1 si hay un tanque).
+    DATA_STRUCTURES::DynamicArray<unsigned char> neighborMask; ///< Máscara de 4 bits por nodo con los vecinos accesibles (ver NEIGHBOR_ROW_OFFSETS).
     DATA_STRUCTURES::DynamicArray<int> safeNodeIdsLeft; ///< Lista de IDs de nodos seguros de la zona izquierda.
     DATA_STRUCTURES::DynamicArray<int> safeNodeIdsRight; ///< Lista de IDs de nodos seguros de la zona derecha.
+    DATA_STRUCTURES::DynamicArray<unsigned char> safe; ///< Plano de nodos seguros en orden de fila mayor (1 si es seguro).
+    unsigned long mapVersion = 0; ///< Versión del mapa; aumenta con cada cambio de accesibilidad.
+    unsigned long occupancyVersion = 0; ///< Versión de la ocupación; aumenta cada vez que se coloca o quita un tanque.
+
+    // Planos de bits que replican walkable, occupied y safe para consultas por palabras completas
+    DATA_STRUCTURES::Bitboard walkableBits; ///< Bit activo si la celda es accesible.
+    DATA_STRUCTURES::Bitboard occupiedBits; ///< Bit activo si la celda tiene un tanque.
+    DATA_STRUCTURES::Bitboard safeBits; ///< Bit activo si la celda es un nodo seguro.
+
+    // Índice de celdas libres (accesibles y no ocupadas)
+    DATA_STRUCTURES::DynamicArray<int> freeCells; ///< IDs de las celdas libres, en orden arbitrario.
+    DATA_STRUCTURES::DynamicArray<int> freeSlot; ///< Posición de cada nodo dentro de freeCells (-1 si no está libre).
+    mutable std::mt19937 rng; ///< Generador aleatorio propio de la instancia.
+
+    /**
+     * @brief Añade o elimina un nodo del índice de celdas libres según su estado actual.
+     *
+     * @param id ID del nodo.
+     */
+    void updateFreeCell(int id);
+
+    /**
+     * @brief Devuelve un entero aleatorio en [0, bound) usando el generador de la instancia.
+     *
+     * @param bound Límite superior exclusivo (mayor que 0).
+     * @return Entero aleatorio.
+     */
+    int randomInt(int bound) const;
+
+    // Análisis de cuellos de botella (caché por versión del mapa)
+    mutable DATA_STRUCTURES::DynamicArray<unsigned char> articulation; ///< Plano de puntos de articulación (1 si bloquearlo desconecta el mapa).
+    mutable DATA_STRUCTURES::DynamicArray<Pair<int, int>> bridges; ///< Aristas cuya eliminación desconecta el mapa.
+    mutable unsigned long chokepointVersion = 0; ///< Versión del mapa con la que se calculó el análisis.
+    mutable bool chokepointsValid = false; ///< Indica si el análisis se ha calculado al menos una vez.
+
+    // Imagen integral del plano de obstáculos (caché por versión del mapa)
+    mutable DATA_STRUCTURES::DynamicArray<int> obstacleSums; ///< Sumas acumuladas de (rows + 1) x (cols + 1).
+    mutable unsigned long obstacleSumsVersion = 0; ///< Versión del mapa con la que se calcularon las sumas.
+    mutable bool obstacleSumsValid = false; ///< Indica si las sumas se han calculado al menos una vez.
+
+    /**
+     * @brief Reconstruye la imagen integral del plano de obstáculos si está desactualizada.
+     */
+    void updateObstacleSums() const;
+
+    // Componentes conexas (caché por versión del mapa)
+    mutable DATA_STRUCTURES::DynamicArray<int> componentId; ///< Componente de cada nodo en orden de fila mayor (-1 si es obstáculo).
+    mutable int componentCount = 0; ///< Número de componentes de nodos accesibles.
+    mutable unsigned long componentVersion = 0; ///< Versión del mapa con la que se etiquetaron las componentes.
+    mutable bool componentsValid = false; ///< Indica si las componentes se han etiquetado al menos una vez.
+
+    /**
+     * @brief Etiqueta las componentes conexas en una sola pasada si la caché está desactualizada.
+     */
+    void labelComponents() const;
+
+    /**
+     * @brief Calcula puntos de articulación y puentes en una sola pasada O(V + E) si la caché está desactualizada.
+     */
+    void analyzeChokepoints() const;
+
+    /**
+     * @brief Calcula las zonas seguras izquierda y derecha según las dimensiones de la cuadrícula.
+     */
+    void initializeSafeZones();
+
+    /**
+     * @brief Recalcula la máscara de vecinos de un único nodo.
+     *
+     * @param row Fila del nodo.
+     * @param col Columna del nodo.
+     */
+    void updateNeighborMask(int row, int col);
 
 public:
+    // Dimensiones
+    static constexpr int DEFAULT_ROWS = 13; ///< Número predeterminado de filas.
+    static constexpr int DEFAULT_COLS = 25; ///< Número predeterminado de columnas.
+    static constexpr int MIN_ROWS = 3; ///< Número mínimo de filas (alto mínimo de las zonas seguras).
+    static constexpr int MIN_COLS = 5; ///< Número mínimo de columnas (dos zonas seguras y una columna central).
+
+    // Vecindad
+    static constexpr int NEIGHBOR_COUNT = 4; ///< Número de vecinos de un nodo (4-conectividad).
+    static constexpr int NEIGHBOR_ROW_OFFSETS[NEIGHBOR_COUNT] = {-1, 1, 0, 0}; ///< Desplazamiento de fila por dirección (arriba, abajo, izquierda, derecha).
+    static constexpr int NEIGHBOR_COL_OFFSETS[NEIGHBOR_COUNT] = {0, 0, -1, 1}; ///< Desplazamiento de columna por dirección.
+
     // Constructor
     /**
      * @brief Constructor de la clase GridGraph. Inicializa la cuadrícula de nodos.
+     *
+     * @param rows Número de filas de la cuadrícula.
+     * @param cols Número de columnas de la cuadrícula.
+     * @throws std::invalid_argument Si las dimensiones son menores que MIN_ROWS x MIN_COLS.
      */
-    GridGraph();
+    explicit GridGraph(int rows = DEFAULT_ROWS, int cols = DEFAULT_COLS);
 
     // Métodos de conversión y acceso
     /**
@@ -73,63 +167,123 @@ public:
     int getCols() const;
 
     /**
-     * @brief Devuelve una referencia constante a un nodo en la posición especificada.
+     * @brief Devuelve una copia del nodo en la posición especificada.
      *
      * @param row Fila del nodo.
      * @param col Columna del nodo.
-     * @return Referencia constante al nodo.
+     * @return Nodo construido a partir de los planos de celdas.
      */
-    const Node& getNode(int row, int col) const;
+    Node getNode(int row, int col) const;
 
     /**
-     * @brief Devuelve una referencia constante al nodo dado su ID.
+     * @brief Devuelve una copia del nodo dado su ID.
      *
      * @param id Identificador único del nodo.
-     * @return Referencia constante al nodo.
+     * @return Nodo construido a partir de los planos de celdas.
      */
-    const Node& getNodeById(int id) const;
+    Node getNodeById(int id) const;
 
     /**
-     * @brief Devuelve una referencia al nodo dado su ID.
+     * @brief Obtiene una posición accesible y no ocupada aleatoria en la cuadrícula, en O(1).
      *
-     * @param id Identificador único del nodo.
-     * @return Referencia al nodo.
+     * @return Objeto Position con la fila y columna de la posición accesible.
+     * @throws std::runtime_error Si no queda ninguna celda libre.
      */
-    Node& getNodeById(int id);
+    Position getRandomAccessiblePosition() const;
 
     /**
-     * @brief Obtiene una posición accesible aleatoria en la cuadrícula.
+     * @brief Devuelve el número de celdas accesibles y no ocupadas.
      *
-     * @return Objeto Position con la fila y columna de la posición accesible.
+     * @return Número de celdas libres.
      */
-    Position getRandomAccessiblePosition() const;
+    int getFreeCellCount() const;
+
+    /**
+     * @brief Devuelve la máscara de vecinos accesibles de un nodo.
+     *
+     * El bit d está encendido si el vecino en la dirección d es accesible.
+     *
+     * @param id Identificador del nodo.
+     * @return Máscara de 4 bits.
+     */
+    unsigned char getNeighborMask(int id) const;
+
+    /**
+     * @brief Calcula el ID del vecino de un nodo en una dirección.
+     *
+     * No verifica límites: usar solo con direcciones presentes en la máscara del nodo.
+     *
+     * @param id Identificador del nodo.
+     * @param direction Índice de dirección en NEIGHBOR_ROW_OFFSETS / NEIGHBOR_COL_OFFSETS.
+     * @return ID del vecino.
+     */
+    int getNeighborId(int id, int direction) const;
+
+    // Planos de bits
+    /**
+     * @brief Devuelve el plano de bits de celdas accesibles.
+     *
+     * @return Referencia constante al plano.
+     */
+    [[nodiscard]] const DATA_STRUCTURES::Bitboard& getWalkableBoard() const;
+
+    /**
+     * @brief Devuelve el plano de bits de celdas ocupadas por tanques.
+     *
+     * @return Referencia constante al plano.
+     */
+    [[nodiscard]] const DATA_STRUCTURES::Bitboard& getOccupiedBoard() const;
 
     /**
-     * @brief Metodo para obtener la lista de adyacencia del grafo.
-     * @return Una referencia constante a la lista de adyacencia.
+     * @brief Devuelve el plano de bits de nodos seguros.
+     *
+     * @return Referencia constante al plano.
      */
-    const DATA_STRUCTURES::DynamicArray<DATA_STRUCTURES::LinkedList<int>>& getAdjList() const;
+    [[nodiscard]] const DATA_STRUCTURES::Bitboard& getSafeBoard() const;
 
     // Métodos de modificación
     /**
-     * @brief Conecta los nodos accesibles en la cuadrícula.
+     * @brief Conecta los nodos accesibles en la cuadrícula, recalculando todas las máscaras de vecinos.
      */
     void connectNodes();
 
     /**
      * @brief Establece la accesibilidad de un nodo específico.
      *
+     * Actualiza de forma incremental las máscaras del nodo y de sus vecinos, sin reconstruir el grafo.
+     *
      * @param row Fila del nodo.
      * @param col Columna del nodo.
      * @param accessible Valor booleano que indica si el nodo es accesible.
      */
     void setNodeAccessibility(int row, int col, bool accessible);
 
+    /**
+     * @brief Devuelve la versión del mapa, útil como clave para cachés.
+     *
+     * @return Contador que aumenta con cada cambio de accesibilidad.
+     */
+    [[nodiscard]] unsigned long getMapVersion() const;
+
+    /**
+     * @brief Devuelve la versión de la ocupación, útil junto a getMapVersion() como clave para cachés.
+     *
+     * @return Contador que aumenta cada vez que placeTank() o removeTank() cambian una celda.
+     */
+    [[nodiscard]] unsigned long getOccupancyVersion() const;
+
     /**
      * @brief Genera obstáculos aleatorios en la cuadrícula, marcando nodos como inaccesibles.
      */
     void generateObstacles();
 
+    /**
+     * @brief Genera obstáculos de forma reproducible; la misma semilla y dimensiones producen el mismo mapa.
+     *
+     * @param seed Semilla del generador de la instancia.
+     */
+    void generateObstacles(unsigned int seed);
+
     /**
      * @brief Coloca un tanque en la posición especificada.
      *
@@ -205,6 +359,54 @@ public:
 
     bool isConnected(int startId, int goalId);
 
+    /**
+     * @brief Verifica en O(1) si dos nodos son mutuamente alcanzables.
+     *
+     * @param firstId ID del primer nodo.
+     * @param secondId ID del segundo nodo.
+     * @return true Si ambos nodos son accesibles y pertenecen a la misma componente conexa.
+     */
+    [[nodiscard]] bool areConnected(int firstId, int secondId) const;
+
+    /**
+     * @brief Devuelve la componente conexa de un nodo.
+     *
+     * @param id ID del nodo.
+     * @return ID de la componente, o -1 si el nodo es un obstáculo.
+     */
+    [[nodiscard]] int getComponentId(int id) const;
+
+    /**
+     * @brief Devuelve el número de componentes conexas de nodos accesibles.
+     *
+     * @return Número de componentes.
+     */
+    [[nodiscard]] int getComponentCount() const;
+
+    // Métodos de análisis
+    /**
+     * @brief Verifica si un nodo es un cuello de botella (punto de articulación del grafo accesible).
+     *
+     * @param row Fila del nodo.
+     * @param col Columna del nodo.
+     * @return true Si convertir el nodo en obstáculo desconecta parte del mapa.
+     */
+    [[nodiscard]] bool isChokepoint(int row, int col) const;
+
+    /**
+     * @brief Devuelve los IDs de todos los cuellos de botella del mapa.
+     *
+     * @return Arreglo con los IDs en orden de fila mayor.
+     */
+    [[nodiscard]] DATA_STRUCTURES::DynamicArray<int> getChokepoints() const;
+
+    /**
+     * @brief Devuelve los puentes del grafo accesible (aristas cuya eliminación desconecta el mapa).
+     *
+     * @return Referencia constante a los pares de IDs de cada puente.
+     */
+    [[nodiscard]] const DATA_STRUCTURES::DynamicArray<Pair<int, int>>& getBridges() const;
+
     /**
      * @brief Asegura que cada línea tenga al menos un obstáculo.
      */
@@ -212,8 +414,23 @@ public:
 
     /**
      * @brief Rellena áreas abiertas grandes con obstáculos para evitar espacios vacíos.
+     *
+     * @param areaSize Lado de las ventanas cuadradas que no deben quedar vacías.
      */
-    void fillLargeOpenAreas();
+    void fillLargeOpenAreas(int areaSize = 4);
+
+    /**
+     * @brief Cuenta los obstáculos dentro de un rectángulo de la cuadrícula en O(1).
+     *
+     * Usa una imagen integral del plano de obstáculos que se reconstruye cuando cambia la versión del mapa.
+     *
+     * @param row Fila superior del rectángulo.
+     * @param col Columna izquierda del rectángulo.
+     * @param height Número de filas del rectángulo.
+     * @param width Número de columnas del rectángulo.
+     * @return Número de obstáculos en el rectángulo.
+     */
+    [[nodiscard]] int countObstacles(int row, int col, int height, int width) const;
 
     /**
     * @brief Verifica si una posición es válida dentro de la cuadrícula.
@@ -221,8 +438,45 @@ public:
     * @param column Columna de la posición.
     * @return true si la posición es válida, false en caso contrario.
     */
-    [[nodiscard]] static bool isValid(int row, int column) ;
+    [[nodiscard]] bool isValid(int row, int column) const;
 
 };
 
+// Accesos de uso intensivo: se definen en línea para que las búsquedas y los escaneos
+// del mapa lean los planos de celdas sin una llamada a función por celda. Leen los planos
+// por su puntero, sin la verificación de límites de DynamicArray::at(): el índice sale de
+// coordenadas que el llamador ya validó.
+
+inline int GridGraph::toIndex(int row, int col) const {
+    return row * cols + col;
+}
+
+inline int GridGraph::getRows() const {
+    return rows;
+}
+
+inline int GridGraph::getCols() const {
+    return cols;
+}
+
+inline bool GridGraph::isValid(const int row, const int column) const {
+    return row >= 0 && row < rows && column >= 0 && column < cols;
+}
+
+inline unsigned char GridGraph::getNeighborMask(int id) const {
+    return neighborMask.rawData()[id];
+}
+
+inline int GridGraph::getNeighborId(int id, int direction) const {
+    return id + NEIGHBOR_ROW_OFFSETS[direction] * cols + NEIGHBOR_COL_OFFSETS[direction];
+}
+
+inline bool GridGraph::isObstacle(int row, int col) const {
+    return !walkable.rawData()[toIndex(row, col)];
+}
+
+inline bool GridGraph::isOccupied(int row, int col) const {
+    return occupied.rawData()[toIndex(row, col)];
+}
+
 #endif // GRIDGRAPH_H
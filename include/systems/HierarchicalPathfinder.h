@@ -0,0 +1,156 @@
+#ifndef HIERARCHICALPATHFINDER_H
+#define HIERARCHICALPATHFINDER_H
+
+#include "GridGraph.h"
+#include "Path.h"
+#include "SearchWorkspace.h"
+#include "data_structures/DynamicArray.h"
+
+/**
+ * @brief Búsqueda jerárquica de caminos (HPA*) 4-conexa para mapas grandes.
+ *
+ * El mapa se divide en clusters cuadrados. En cada frontera entre dos clusters, los tramos de celdas
+ * libres a ambos lados generan entradas: una en el centro de los tramos cortos y dos en los extremos de
+ * los largos. Cada cluster guarda las distancias internas entre sus entradas. Una consulta busca con A*
+ * sobre ese grafo abstracto y después refina cada tramo con una BFS limitada a un solo cluster, así que
+ * los caminos celda a celda solo se calculan para los tramos que se usan.
+ *
+ * Los caminos son casi óptimos: pueden ser algo más largos que los de Pathfinder::bfs().
+ *
+ * No acepta máscara de bloqueo: las distancias entre entradas se precalculan sobre el mapa sin tanques,
+ * así que los caminos pueden pasar por celdas ocupadas. Quien necesite evitar tanques debe comprobar el
+ * camino contra GridGraph::getOccupiedBoard() y, si lo cruza, buscar con Pathfinder y la máscara.
+ *
+ * Los cambios de accesibilidad se comunican con cellChanged() y solo reconstruyen los clusters
+ * afectados en la siguiente consulta. Si el mapa cambió sin avisar, se reconstruye todo.
+ */
+class HierarchicalPathfinder {
+private:
+    /**
+     * @brief Región rectangular del mapa con sus entradas y las distancias internas entre ellas.
+     */
+    struct Cluster {
+        int firstRow = 0; ///< Primera fila del cluster.
+        int firstCol = 0; ///< Primera columna del cluster.
+        int rows = 0; ///< Número de filas del cluster.
+        int cols = 0; ///< Número de columnas del cluster.
+        DATA_STRUCTURES::DynamicArray<int> entrances; ///< IDs de las celdas de entrada.
+        DATA_STRUCTURES::DynamicArray<int> distances; ///< Distancias entre entradas (k x k, -1 si no hay camino interno).
+    };
+
+    const GridGraph& graph; ///< Mapa sobre el que se busca.
+    int clusterSize; ///< Lado de los clusters en celdas.
+    int clusterRows = 0; ///< Número de filas de clusters.
+    int clusterCols = 0; ///< Número de columnas de clusters.
+    DATA_STRUCTURES::DynamicArray<Cluster> clusters; ///< Clusters en orden de fila mayor.
+    DATA_STRUCTURES::DynamicArray<int> entranceSlot; ///< Índice de cada celda en las entradas de su cluster, o -1.
+
+    bool built = false; ///< Indica si la estructura está construida.
+    unsigned long builtVersion = 0; ///< Versión del mapa con la que está al día.
+    unsigned long pendingChanges = 0; ///< Cambios avisados con cellChanged() desde builtVersion.
+    DATA_STRUCTURES::DynamicArray<unsigned char> dirty; ///< Marca de los clusters pendientes de reconstruir.
+    DATA_STRUCTURES::DynamicArray<int> dirtyClusters; ///< Clusters pendientes de reconstruir.
+
+    SearchWorkspace workspace; ///< Memoria de la búsqueda abstracta.
+    DATA_STRUCTURES::DynamicArray<int> localDistance; ///< Distancias de la BFS dentro de un cluster.
+    DATA_STRUCTURES::DynamicArray<int> localParent; ///< Padres (índices locales) de la BFS dentro de un cluster.
+    DATA_STRUCTURES::DynamicArray<int> localQueue; ///< Cola de la BFS dentro de un cluster.
+    DATA_STRUCTURES::DynamicArray<int> startDistance; ///< Distancia del origen a cada entrada de su cluster.
+    DATA_STRUCTURES::DynamicArray<int> goalDistance; ///< Distancia de cada entrada del cluster del destino al destino.
+    DATA_STRUCTURES::DynamicArray<int> waypoints; ///< Camino abstracto de la última consulta.
+    int expandedNodes = 0; ///< Nodos abstractos expandidos por la última consulta.
+
+    /**
+     * @brief Devuelve el cluster que contiene una celda.
+     */
+    int clusterOf(int row, int col) const;
+
+    /**
+     * @brief Añade a un cluster las entradas de una de sus fronteras (0 arriba, 1 abajo, 2 izquierda, 3 derecha).
+     */
+    void collectBorderEntrances(int clusterIndex, int side);
+
+    /**
+     * @brief Recalcula las entradas y las distancias internas de un cluster.
+     */
+    void buildCluster(int clusterIndex);
+
+    /**
+     * @brief Construye todos los clusters desde cero.
+     */
+    void buildAll();
+
+    /**
+     * @brief Reconstruye los clusters marcados o, si el mapa cambió sin avisar, todos.
+     */
+    void ensureUpToDate();
+
+    /**
+     * @brief BFS limitada a un cluster; deja distancias y padres locales en localDistance y localParent.
+     *
+     * @param clusterIndex Cluster en el que se busca.
+     * @param source Celda de origen.
+     * @param target Celda en la que detenerse, o -1 para recorrer todo el cluster.
+     */
+    void searchCluster(int clusterIndex, int source, int target);
+
+    /**
+     * @brief Devuelve el índice local de una celda dentro de un cluster.
+     */
+    int localIndex(const Cluster& cluster, int id) const;
+
+    /**
+     * @brief Añade al camino el tramo de a a b (sin a) calculado con una BFS dentro de un cluster.
+     * @return false si no hay camino interno.
+     */
+    bool appendClusterPath(int clusterIndex, int a, int b, Path& path);
+
+public:
+    static constexpr int DEFAULT_CLUSTER_SIZE = 16; ///< Lado predeterminado de los clusters.
+    static constexpr int SINGLE_ENTRANCE_LENGTH = 6; ///< Los tramos más cortos generan una sola entrada.
+
+    /**
+     * @brief Constructor (la estructura se construye en la primera consulta).
+     *
+     * @param graph Mapa sobre el que se busca.
+     * @param clusterSize Lado de los clusters en celdas.
+     * @throws std::invalid_argument Si clusterSize es menor que 2.
+     */
+    explicit HierarchicalPathfinder(const GridGraph& graph, int clusterSize = DEFAULT_CLUSTER_SIZE);
+
+    /**
+     * @brief Construye o reconstruye la estructura completa.
+     */
+    void build();
+
+    /**
+     * @brief Avisa de que una celda cambió de accesibilidad para reconstruir solo los clusters afectados.
+     *
+     * Debe llamarse una vez por cada cambio efectivo de GridGraph::setNodeAccessibility().
+     *
+     * @param row Fila de la celda.
+     * @param col Columna de la celda.
+     */
+    void cellChanged(int row, int col);
+
+    /**
+     * @brief Busca un camino casi óptimo entre dos posiciones.
+     *
+     * @param src Posición de inicio.
+     * @param dest Posición de destino.
+     * @return Camino desde el inicio hasta el objetivo en el formato de Pathfinder::bfs() (vacío si no existe).
+     */
+    Path findPath(Position src, Position dest);
+
+    /**
+     * @brief Devuelve el número de entradas (nodos abstractos) de todos los clusters.
+     */
+    [[nodiscard]] int getEntranceCount() const;
+
+    /**
+     * @brief Devuelve el número de nodos abstractos expandidos por la última consulta.
+     */
+    [[nodiscard]] int getExpandedNodeCount() const;
+};
+
+#endif // HIERARCHICALPATHFINDER_H
@@ -0,0 +1,252 @@
+#ifndef MAPCORPUS_H
+#define MAPCORPUS_H
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include "GridGraph.h"
+#include "MapFarm.h"
+
+/**
+ * @brief Formato binario de colecciones de mapas (versión 1). Todos los enteros son little-endian.
+ *
+ * Cabecera (HEADER_SIZE bytes):
+ *   - 0:  firma "TAMC"
+ *   - 4:  u16 versión del formato
+ *   - 6:  u16 tamaño de la cabecera
+ *   - 8:  u32 filas
+ *   - 12: u32 columnas
+ *   - 16: u32 número de mapas
+ *   - 20: u32 bytes por registro
+ *   - 24: u32 bytes de un plano empaquetado
+ *   - 28: u32 reservado (0)
+ *
+ * Tras la cabecera va el plano de nodos seguros (común a todos los mapas, ya que depende solo de las
+ * dimensiones) y, alineados a 8 bytes, los registros de cada mapa:
+ *   - 0:  u32 semilla
+ *   - 4:  u32 número de obstáculos
+ *   - 8:  u32 número de componentes conexas
+ *   - 12: u32 número de puntos de articulación
+ *   - 16: plano de obstáculos empaquetado
+ *
+ * Los planos usan 1 bit por celda en orden de fila mayor, bit menos significativo primero.
+ */
+namespace MapFormat {
+    constexpr char MAGIC[4] = {'T', 'A', 'M', 'C'}; ///< Firma del archivo.
+    constexpr int VERSION = 1; ///< Versión actual del formato.
+    constexpr int HEADER_SIZE = 32; ///< Tamaño de la cabecera en bytes.
+    constexpr int RECORD_METADATA_SIZE = 16; ///< Bytes de metadatos al inicio de cada registro.
+    constexpr int ALIGNMENT = 8; ///< Alineación de la sección de registros y de cada registro.
+}
+
+/**
+ * @brief Vista de solo lectura de un mapa dentro de un MapCorpus, sin copiar sus datos.
+ *
+ * Solo es válida mientras viva el MapCorpus del que se obtuvo.
+ */
+class MapView {
+private:
+    const unsigned char* record; ///< Inicio del registro del mapa.
+    const unsigned char* safePlane; ///< Plano de nodos seguros compartido.
+    int rows; ///< Número de filas.
+    int cols; ///< Número de columnas.
+
+public:
+    /**
+     * @brief Constructor de la vista.
+     *
+     * @param record Inicio del registro del mapa.
+     * @param safePlane Plano de nodos seguros compartido.
+     * @param rows Número de filas.
+     * @param cols Número de columnas.
+     */
+    MapView(const unsigned char* record, const unsigned char* safePlane, int rows, int cols);
+
+    /**
+     * @brief Devuelve el número de filas del mapa.
+     *
+     * @return Número de filas.
+     */
+    [[nodiscard]] int getRows() const;
+
+    /**
+     * @brief Devuelve el número de columnas del mapa.
+     *
+     * @return Número de columnas.
+     */
+    [[nodiscard]] int getCols() const;
+
+    /**
+     * @brief Devuelve la semilla con la que se generó el mapa.
+     */
+    [[nodiscard]] unsigned int getSeed() const;
+
+    /**
+     * @brief Devuelve el número de celdas bloqueadas.
+     */
+    [[nodiscard]] int getObstacleCount() const;
+
+    /**
+     * @brief Devuelve el número de componentes conexas de celdas accesibles.
+     */
+    [[nodiscard]] int getComponentCount() const;
+
+    /**
+     * @brief Devuelve el número de puntos de articulación del mapa.
+     */
+    [[nodiscard]] int getChokepointCount() const;
+
+    /**
+     * @brief Verifica si una celda es un obstáculo.
+     *
+     * @param row Fila de la celda.
+     * @param col Columna de la celda.
+     * @return true Si la celda está bloqueada.
+     */
+    [[nodiscard]] bool isObstacle(int row, int col) const;
+
+    /**
+     * @brief Verifica si una celda pertenece a una zona segura.
+     *
+     * @param row Fila de la celda.
+     * @param col Columna de la celda.
+     * @return true Si la celda es un nodo seguro.
+     */
+    [[nodiscard]] bool isSafeNode(int row, int col) const;
+
+    /**
+     * @brief Devuelve el plano de obstáculos empaquetado.
+     *
+     * @return Puntero a los bytes del plano.
+     */
+    [[nodiscard]] const unsigned char* getObstaclePlane() const;
+
+    /**
+     * @brief Copia la accesibilidad del mapa en un GridGraph de las mismas dimensiones.
+     *
+     * @param graph Grafo de destino.
+     * @throws std::invalid_argument Si las dimensiones no coinciden.
+     */
+    void loadInto(GridGraph& graph) const;
+};
+
+/**
+ * @brief Colección de mapas leída de un archivo mediante mmap.
+ *
+ * El archivo se proyecta completo en memoria; las vistas apuntan directamente a sus bytes, por lo que
+ * abrir una colección no cuesta generación ni copias.
+ */
+class MapCorpus {
+private:
+    const unsigned char* data = nullptr; ///< Inicio del archivo proyectado.
+    std::size_t fileSize = 0; ///< Tamaño del archivo en bytes.
+    int rows = 0; ///< Número de filas de cada mapa.
+    int cols = 0; ///< Número de columnas de cada mapa.
+    int mapCount = 0; ///< Número de mapas.
+    int recordSize = 0; ///< Bytes por registro.
+    const unsigned char* safePlane = nullptr; ///< Plano de nodos seguros.
+    const unsigned char* records = nullptr; ///< Inicio de la sección de registros.
+
+public:
+    /**
+     * @brief Abre y valida una colección de mapas.
+     *
+     * @param path Ruta del archivo.
+     * @throws std::runtime_error Si el archivo no se puede abrir o no tiene un formato válido.
+     */
+    explicit MapCorpus(const std::string& path);
+
+    /**
+     * @brief Libera la proyección del archivo.
+     */
+    ~MapCorpus();
+
+    MapCorpus(const MapCorpus&) = delete;
+    MapCorpus& operator=(const MapCorpus&) = delete;
+
+    /**
+     * @brief Devuelve el número de mapas de la colección.
+     *
+     * @return Número de mapas.
+     */
+    [[nodiscard]] int getMapCount() const;
+
+    /**
+     * @brief Devuelve el número de filas de cada mapa.
+     *
+     * @return Número de filas.
+     */
+    [[nodiscard]] int getRows() const;
+
+    /**
+     * @brief Devuelve el número de columnas de cada mapa.
+     *
+     * @return Número de columnas.
+     */
+    [[nodiscard]] int getCols() const;
+
+    /**
+     * @brief Devuelve una vista del mapa indicado.
+     *
+     * @param index Índice del mapa.
+     * @return Vista sin copia del mapa.
+     * @throws std::out_of_range Si el índice no es válido.
+     */
+    [[nodiscard]] MapView getMap(int index) const;
+};
+
+/**
+ * @brief Escritor secuencial de colecciones de mapas en el formato de MapFormat.
+ */
+class MapCorpusWriter {
+private:
+    std::ofstream out; ///< Archivo de salida.
+    GridGraph scratch; ///< Grafo auxiliar para calcular los metadatos de los lotes.
+    int rows; ///< Número de filas de cada mapa.
+    int cols; ///< Número de columnas de cada mapa.
+    int planeBytes; ///< Bytes de un plano empaquetado.
+    int recordSize; ///< Bytes por registro.
+    int mapCount = 0; ///< Mapas escritos hasta ahora.
+
+public:
+    /**
+     * @brief Crea el archivo y escribe la cabecera y el plano de nodos seguros.
+     *
+     * @param path Ruta del archivo.
+     * @param rows Número de filas de cada mapa.
+     * @param cols Número de columnas de cada mapa.
+     * @throws std::runtime_error Si el archivo no se puede crear.
+     */
+    MapCorpusWriter(const std::string& path, int rows = GridGraph::DEFAULT_ROWS, int cols = GridGraph::DEFAULT_COLS);
+
+    /**
+     * @brief Cierra el archivo si sigue abierto.
+     */
+    ~MapCorpusWriter();
+
+    /**
+     * @brief Añade un mapa a la colección.
+     *
+     * @param graph Mapa a guardar.
+     * @param seed Semilla con la que se generó.
+     * @throws std::invalid_argument Si las dimensiones no coinciden con las de la colección.
+     */
+    void append(const GridGraph& graph, unsigned int seed);
+
+    /**
+     * @brief Añade todos los mapas de un lote, conservando sus semillas.
+     *
+     * @param farm Lote de mapas.
+     * @throws std::invalid_argument Si las dimensiones no coinciden con las de la colección.
+     */
+    void append(const MapFarm& farm);
+
+    /**
+     * @brief Actualiza el número de mapas de la cabecera y cierra el archivo.
+     *
+     * @throws std::runtime_error Si falla la escritura.
+     */
+    void close();
+};
+
+#endif // MAPCORPUS_H
@@ -0,0 +1,119 @@
+#ifndef MAPFARM_H
+#define MAPFARM_H
+
+#include "GridGraph.h"
+#include "data_structures/DynamicArray.h"
+
+/**
+ * @brief Clase que genera lotes de mapas reproducibles en paralelo y los guarda de forma compacta.
+ *
+ * El mapa i del lote se genera con la semilla baseSeed + i, de modo que cualquier mapa puede
+ * reconstruirse por separado con GridGraph::generateObstacles(getSeed(i)). Cada mapa se almacena
+ * como su plano de accesibilidad empaquetado a 1 bit por celda (fila mayor, bit menos significativo
+ * primero, 1 si es accesible), en un único bloque contiguo.
+ */
+class MapFarm {
+private:
+    int rows; ///< Número de filas de cada mapa.
+    int cols; ///< Número de columnas de cada mapa.
+    int mapCount = 0; ///< Número de mapas del lote.
+    unsigned int baseSeed = 0; ///< Semilla del primer mapa del lote.
+    int bytesPerMap; ///< Bytes que ocupa cada mapa empaquetado.
+    DATA_STRUCTURES::DynamicArray<unsigned char> bits; ///< Mapas empaquetados, uno tras otro.
+
+    /**
+     * @brief Genera y empaqueta los mapas del rango [first, last).
+     *
+     * @param first Índice del primer mapa.
+     * @param last Índice siguiente al último mapa.
+     */
+    void generateRange(int first, int last);
+
+public:
+    /**
+     * @brief Constructor de la clase MapFarm.
+     *
+     * @param rows Número de filas de cada mapa.
+     * @param cols Número de columnas de cada mapa.
+     * @throws std::invalid_argument Si las dimensiones son menores que GridGraph::MIN_ROWS x GridGraph::MIN_COLS.
+     */
+    explicit MapFarm(int rows = GridGraph::DEFAULT_ROWS, int cols = GridGraph::DEFAULT_COLS);
+
+    /**
+     * @brief Genera un lote de mapas repartiendo el trabajo entre varios hilos.
+     *
+     * Sustituye el lote anterior. El resultado depende solo de la semilla, las dimensiones y el número de
+     * mapas, nunca del número de hilos.
+     *
+     * @param count Número de mapas a generar.
+     * @param seed Semilla del primer mapa.
+     * @param threadCount Número de hilos (0 para usar todos los núcleos disponibles).
+     * @throws std::length_error Si el lote no cabe en un único bloque.
+     */
+    void generate(int count, unsigned int seed, int threadCount = 0);
+
+    /**
+     * @brief Devuelve el número de mapas del lote.
+     *
+     * @return Número de mapas.
+     */
+    [[nodiscard]] int getMapCount() const;
+
+    /**
+     * @brief Devuelve el número de filas de cada mapa.
+     *
+     * @return Número de filas.
+     */
+    [[nodiscard]] int getRows() const;
+
+    /**
+     * @brief Devuelve el número de columnas de cada mapa.
+     *
+     * @return Número de columnas.
+     */
+    [[nodiscard]] int getCols() const;
+
+    /**
+     * @brief Devuelve los bytes que ocupa cada mapa empaquetado.
+     *
+     * @return Bytes por mapa.
+     */
+    [[nodiscard]] int getBytesPerMap() const;
+
+    /**
+     * @brief Devuelve la semilla con la que se generó un mapa del lote.
+     *
+     * @param map Índice del mapa.
+     * @return Semilla del mapa.
+     */
+    [[nodiscard]] unsigned int getSeed(int map) const;
+
+    /**
+     * @brief Devuelve los bytes empaquetados de un mapa.
+     *
+     * @param map Índice del mapa.
+     * @return Puntero a los getBytesPerMap() bytes del mapa.
+     */
+    [[nodiscard]] const unsigned char* getMapData(int map) const;
+
+    /**
+     * @brief Verifica si una celda de un mapa del lote es accesible.
+     *
+     * @param map Índice del mapa.
+     * @param row Fila de la celda.
+     * @param col Columna de la celda.
+     * @return true Si la celda es accesible.
+     */
+    [[nodiscard]] bool isWalkable(int map, int row, int col) const;
+
+    /**
+     * @brief Copia la accesibilidad de un mapa del lote en un GridGraph de las mismas dimensiones.
+     *
+     * @param map Índice del mapa.
+     * @param graph Grafo de destino.
+     * @throws std::invalid_argument Si las dimensiones del grafo no coinciden con las del lote.
+     */
+    void loadMap(int map, GridGraph& graph) const;
+};
+
+#endif // MAPFARM_H
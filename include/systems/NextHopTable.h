@@ -0,0 +1,104 @@
+#ifndef NEXTHOPTABLE_H
+#define NEXTHOPTABLE_H
+
+#include <cstddef>
+#include "GridGraph.h"
+#include "Path.h"
+#include "data_structures/DynamicArray.h"
+
+/**
+ * @brief Tabla precalculada de distancias y siguiente salto entre todos los pares de celdas de un mapa.
+ *
+ * Para cada par (origen, destino) guarda la distancia 4-conexa más corta (2 bytes) y la dirección del
+ * primer paso (1 byte), así que una distancia se consulta en O(1) y un camino en O(longitud). Ocupa
+ * 3 * celdas^2 bytes, por lo que solo se construye en mapas de hasta maxCells celdas; en mapas mayores
+ * build() no hace nada e isValid() devuelve false.
+ *
+ * La tabla queda asociada a la versión del mapa con la que se construyó: cualquier cambio de
+ * accesibilidad la invalida hasta el siguiente build().
+ */
+class NextHopTable {
+private:
+    const GridGraph& graph; ///< Mapa sobre el que se calcula la tabla.
+    int maxCells; ///< Número máximo de celdas con el que se construye la tabla.
+    int nodeCount = 0; ///< Número de celdas del mapa con el que se construyó.
+    bool built = false; ///< Indica si hay una tabla construida.
+    unsigned long builtVersion = 0; ///< Versión del mapa con la que se construyó.
+    DATA_STRUCTURES::DynamicArray<unsigned short> distances; ///< Distancia de cada par, en orden origen * nodeCount + destino.
+    DATA_STRUCTURES::DynamicArray<unsigned char> nextHops; ///< Dirección del primer paso de cada par.
+
+    /**
+     * @brief Rellena las filas de la tabla de los orígenes [first, last) con una BFS por origen.
+     *
+     * @param first Primer origen.
+     * @param last Origen siguiente al último.
+     * @param queue Cola de trabajo de nodeCount posiciones.
+     */
+    void buildRange(int first, int last, DATA_STRUCTURES::DynamicArray<int>& queue);
+
+public:
+    static constexpr int DEFAULT_MAX_CELLS = 2048; ///< Límite predeterminado de celdas (~12 MB de tabla).
+    static constexpr int MAX_CELLS_LIMIT = 46340; ///< Límite absoluto para que celdas^2 quepa en un int.
+    static constexpr unsigned short UNREACHABLE = 0xFFFF; ///< Distancia de los pares sin camino.
+    static constexpr unsigned char NO_HOP = 0xFF; ///< Siguiente salto de los pares sin camino o de origen = destino.
+
+    /**
+     * @brief Constructor de la tabla (vacía hasta que se llama a build()).
+     *
+     * @param graph Mapa sobre el que se calcula la tabla.
+     * @param maxCells Número máximo de celdas con el que se construye la tabla.
+     * @throws std::invalid_argument Si maxCells no está en [0, MAX_CELLS_LIMIT].
+     */
+    explicit NextHopTable(const GridGraph& graph, int maxCells = DEFAULT_MAX_CELLS);
+
+    /**
+     * @brief Construye la tabla repartiendo los orígenes entre varios hilos.
+     *
+     * @param threadCount Número de hilos (0 para usar todos los núcleos disponibles).
+     * @return true si se construyó; false si el mapa supera maxCells.
+     */
+    bool build(int threadCount = 0);
+
+    /**
+     * @brief Verifica si la tabla está construida y corresponde a la versión actual del mapa.
+     */
+    [[nodiscard]] bool isValid() const;
+
+    /**
+     * @brief Devuelve la distancia más corta entre dos celdas en O(1). Requiere isValid().
+     *
+     * @param src Posición de origen.
+     * @param dest Posición de destino.
+     * @return Número de pasos, o -1 si no hay camino.
+     */
+    [[nodiscard]] int getDistance(Position src, Position dest) const;
+
+    /**
+     * @brief Reconstruye un camino más corto siguiendo los saltos de la tabla. Requiere isValid().
+     *
+     * @param src Posición de origen.
+     * @param dest Posición de destino.
+     * @return Camino desde el origen hasta el destino en el formato de Pathfinder::bfs() (vacío si no existe).
+     */
+    [[nodiscard]] Path getPath(Position src, Position dest) const;
+
+    /**
+     * @brief Devuelve el número máximo de celdas con el que se construye la tabla.
+     */
+    [[nodiscard]] int getMaxCells() const;
+
+    /**
+     * @brief Cambia el número máximo de celdas; se aplica en el siguiente build().
+     *
+     * @param maxCells Nuevo límite.
+     * @throws std::invalid_argument Si maxCells no está en [0, MAX_CELLS_LIMIT].
+     */
+    void setMaxCells(int maxCells);
+
+    /**
+     * @brief Devuelve la memoria ocupada por la tabla construida, en bytes.
+     */
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+};
+
+#endif // NEXTHOPTABLE_H
@@ -0,0 +1,101 @@
+#ifndef PATH_H
+#define PATH_H
+
+#include "Position.h"
+#include "data_structures/DynamicArray.h"
+
+/**
+ * @brief Camino como secuencia contigua de posiciones con un cursor de recorrido.
+ *
+ * Es un tipo valor: las búsquedas lo devuelven por movimiento y un camino vacío indica que no hay ruta.
+ * El acceso por índice es O(1) y el cursor permite que las animaciones avancen paso a paso sin
+ * llevar un contador aparte.
+ */
+class Path {
+private:
+    DATA_STRUCTURES::DynamicArray<Position> positions; ///< Posiciones del camino en orden de recorrido.
+    int cursor = 0; ///< Índice de la siguiente posición a recorrer.
+
+public:
+    /**
+     * @brief Construye un camino vacío.
+     */
+    Path() = default;
+
+    /**
+     * @brief Construye un camino de length posiciones, para rellenarlas por índice.
+     * @param length Número de posiciones.
+     */
+    explicit Path(int length) : positions(length) {}
+
+    /**
+     * @brief Devuelve el número de posiciones del camino.
+     */
+    int size() const { return positions.size(); }
+
+    /**
+     * @brief Verifica si el camino está vacío (no hay ruta).
+     */
+    bool empty() const { return positions.empty(); }
+
+    /**
+     * @brief Accede a una posición del camino en O(1).
+     * @param index Índice de la posición.
+     */
+    const Position& at(int index) const { return positions[index]; }
+    Position& operator[](int index) { return positions[index]; }
+    const Position& operator[](int index) const { return positions[index]; }
+
+    /**
+     * @brief Devuelve la última posición del camino.
+     */
+    const Position& back() const { return positions.back(); }
+
+    /**
+     * @brief Agrega una posición al final del camino.
+     * @param position Posición a agregar.
+     */
+    void push_back(const Position& position) { positions.push_back(position); }
+
+    /**
+     * @brief Cambia el número de posiciones conservando las primeras; las nuevas quedan para rellenar por índice.
+     * @param length Nuevo número de posiciones.
+     */
+    void resize(const int length) { positions.resize(length); }
+
+    /**
+     * @brief Vacía el camino y reinicia el cursor.
+     */
+    void clear() {
+        positions.clear();
+        cursor = 0;
+    }
+
+    // Recorrido
+    /**
+     * @brief Verifica si el cursor ya recorrió todas las posiciones.
+     */
+    bool finished() const { return cursor >= positions.size(); }
+
+    /**
+     * @brief Devuelve la posición bajo el cursor (requiere !finished()).
+     */
+    const Position& current() const { return positions[cursor]; }
+
+    /**
+     * @brief Avanza el cursor a la siguiente posición.
+     */
+    void advance() { ++cursor; }
+
+    /**
+     * @brief Devuelve el índice de la posición bajo el cursor.
+     */
+    int getCursor() const { return cursor; }
+
+    /**
+     * @brief Devuelve el cursor al inicio del camino.
+     */
+    void rewind() { cursor = 0; }
+};
+
+#endif // PATH_H
@@ -0,0 +1,142 @@
+#ifndef PATHCACHE_H
+#define PATHCACHE_H
+
+#include "GridGraph.h"
+#include "Path.h"
+#include "Pathfinder.h"
+#include "data_structures/DynamicArray.h"
+
+/**
+ * @brief Caché LRU de caminos indexada por (algoritmo, máscara, origen, destino, versión del mapa, versión de ocupación).
+ *
+ * Las entradas viven en un arreglo fijo de capacity posiciones enlazadas en una lista doble por índices
+ * (de la más a la menos reciente) y se localizan con una tabla hash de encadenamiento, así que find()
+ * y store() son O(1) más la copia del camino. Al llenarse se reutiliza la entrada menos reciente.
+ *
+ * Cuando cambia cualquiera de las dos versiones del grafo la caché se vacía entera en la siguiente
+ * consulta: ningún camino calculado antes de placeTank(), removeTank() o setNodeAccessibility()
+ * puede devolverse después.
+ *
+ * La máscara de bloqueo forma parte de la clave por identidad (su dirección, o nullptr), así que la misma
+ * consulta con y sin máscara, o con máscaras distintas, ocupa entradas distintas. El contenido de
+ * GridGraph::getOccupiedBoard() queda cubierto por la versión de ocupación; quien pase otra máscara y la
+ * modifique debe llamar a clear().
+ */
+class PathCache {
+private:
+    /**
+     * @brief Entrada de la caché: clave, camino y enlaces de la lista LRU y de su cubeta.
+     */
+    struct Entry {
+        PathAlgorithm algorithm = PathAlgorithm::Bfs; ///< Algoritmo que calculó el camino.
+        const DATA_STRUCTURES::Bitboard* blocked = nullptr; ///< Máscara con la que se calculó, o nullptr.
+        int sourceId = -1; ///< ID de la celda de origen.
+        int targetId = -1; ///< ID de la celda de destino.
+        unsigned long mapVersion = 0; ///< Versión del mapa con la que se calculó.
+        unsigned long occupancyVersion = 0; ///< Versión de la ocupación con la que se calculó.
+        Path path; ///< Camino guardado, con el cursor al inicio.
+        int previous = -1; ///< Entrada más reciente que esta, o -1.
+        int next = -1; ///< Entrada menos reciente que esta, o -1.
+        int nextInBucket = -1; ///< Siguiente entrada de la misma cubeta, o -1.
+    };
+
+    const GridGraph& graph; ///< Mapa cuyas versiones invalidan la caché.
+    int capacity; ///< Número máximo de caminos guardados.
+    int count = 0; ///< Número de entradas en uso.
+    int newest = -1; ///< Entrada usada más recientemente, o -1.
+    int oldest = -1; ///< Entrada usada menos recientemente, o -1.
+    DATA_STRUCTURES::DynamicArray<Entry> entries; ///< Entradas en [0, count).
+    DATA_STRUCTURES::DynamicArray<int> buckets; ///< Primera entrada de cada cubeta, o -1 (tamaño potencia de dos).
+    unsigned long cachedMapVersion = 0; ///< Versión del mapa de las entradas guardadas.
+    unsigned long cachedOccupancyVersion = 0; ///< Versión de la ocupación de las entradas guardadas.
+    long hits = 0; ///< Consultas resueltas desde la caché.
+    long misses = 0; ///< Consultas que tuvieron que calcularse.
+
+    /**
+     * @brief Devuelve la cubeta de una clave.
+     */
+    int bucketOf(PathAlgorithm algorithm, const DATA_STRUCTURES::Bitboard* blocked, int sourceId, int targetId) const;
+
+    /**
+     * @brief Vacía la caché si el grafo cambió desde que se guardaron las entradas.
+     */
+    void checkVersions();
+
+    /**
+     * @brief Quita una entrada de la lista LRU.
+     */
+    void unlink(int index);
+
+    /**
+     * @brief Coloca una entrada al frente de la lista LRU.
+     */
+    void pushFront(int index);
+
+    /**
+     * @brief Quita una entrada de su cubeta.
+     */
+    void removeFromBucket(int index);
+
+public:
+    static constexpr int DEFAULT_CAPACITY = 256; ///< Capacidad predeterminada en caminos.
+
+    /**
+     * @brief Constructor de la caché.
+     *
+     * @param graph Mapa sobre el que se calculan los caminos.
+     * @param capacity Número máximo de caminos guardados.
+     * @throws std::invalid_argument Si capacity es menor que 1.
+     */
+    explicit PathCache(const GridGraph& graph, int capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Busca un camino guardado y lo marca como el más reciente. Cuenta un acierto o un fallo.
+     *
+     * @param algorithm Algoritmo que calcularía el camino.
+     * @param src Posición de inicio.
+     * @param dest Posición de destino.
+     * @param blocked Máscara de bloqueo con la que se calcularía, o nullptr.
+     * @return Puntero al camino guardado, o nullptr si no está; deja de ser válido en el siguiente store().
+     */
+    const Path* find(PathAlgorithm algorithm, Position src, Position dest,
+                     const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+    /**
+     * @brief Guarda una copia de un camino, reemplazando la entrada menos reciente si la caché está llena.
+     *
+     * @param algorithm Algoritmo que calculó el camino.
+     * @param src Posición de inicio.
+     * @param dest Posición de destino.
+     * @param path Camino calculado con el estado actual del grafo.
+     * @param blocked Máscara de bloqueo con la que se calculó, o nullptr.
+     */
+    void store(PathAlgorithm algorithm, Position src, Position dest, const Path& path,
+               const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+    /**
+     * @brief Elimina todos los caminos guardados sin tocar los contadores.
+     */
+    void clear();
+
+    /**
+     * @brief Devuelve el número de caminos guardados.
+     */
+    [[nodiscard]] int size() const;
+
+    /**
+     * @brief Devuelve el número máximo de caminos guardados.
+     */
+    [[nodiscard]] int getCapacity() const;
+
+    /**
+     * @brief Devuelve el número de consultas resueltas desde la caché.
+     */
+    [[nodiscard]] long getHitCount() const;
+
+    /**
+     * @brief Devuelve el número de consultas que no estaban en la caché.
+     */
+    [[nodiscard]] long getMissCount() const;
+};
+
+#endif // PATHCACHE_H
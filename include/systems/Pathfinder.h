@@ -2,27 +2,104 @@
 #define PATHFINDER_H
 
 #include "GridGraph.h"
-#include "data_structures/LinkedList.h"
-#include "data_structures/Queue.h"
-#include "data_structures/Stack.h"
+#include "SearchWorkspace.h"
+#include "Path.h"
 
-struct cell {
-	int parent_i, parent_j;
-	double f, g, h;
+/**
+ * @brief Variante de BFS que usa Model para los tanques que buscan con BFS.
+ */
+enum class BfsMode {
+    Queue,       ///< BFS clásica nodo a nodo con una cola.
+    BitParallel, ///< BFS que expande capas completas sobre el plano de bits de accesibilidad.
+    JumpPoint,   ///< Jump Point Search 4-conexa: mismas longitudes que BFS expandiendo solo puntos de salto.
+    Hierarchical ///< HPA* (HierarchicalPathfinder): caminos casi óptimos para mapas grandes.
+};
+
+/**
+ * @brief Algoritmos deterministas de Pathfinder, para elegirlos en tiempo de ejecución con Pathfinder::findPath().
+ */
+enum class PathAlgorithm : unsigned char {
+    Bfs,      ///< Pathfinder::bfs().
+    Dijkstra, ///< Pathfinder::dijkstra().
+    AStar,    ///< Pathfinder::aStar().
+    JumpPointDiagonal ///< Pathfinder::jumpPointSearchDiagonal(): mismos caminos que aStar() expandiendo menos nodos.
 };
 
 /**
  * @brief Clase encargada de los algoritmos de búsqueda de caminos en el GridGraph.
+ *
+ * Las búsquedas aceptan una máscara de bloqueo opcional (blocked): un Bitboard del tamaño del mapa
+ * con las celdas que no se pueden atravesar además de los obstáculos, como GridGraph::getOccupiedBoard()
+ * o reservas propias. La celda de inicio nunca se considera bloqueada, así que la ocupación del propio
+ * tanque no estorba, y un destino bloqueado no tiene camino. La máscara no modifica el grafo: cuesta
+ * una prueba de bit por nodo expandido.
  */
 class Pathfinder {
 private:
     GridGraph& graph;  ///< Referencia al grafo sobre el cual se hacen las búsquedas.
+    SearchWorkspace workspace; ///< Memoria reutilizada entre búsquedas (marcas por generación).
+    SearchWorkspace reverseWorkspace; ///< Memoria del lado del destino en la BFS bidireccional.
+    int expandedNodes = 0; ///< Nodos expandidos por la última búsqueda.
+
+    /**
+     * @brief Calcula capas de BFS bit-paralelas y deja la distancia de cada celda alcanzada en
+     * workspace.layerDistance (-1 en las celdas no alcanzadas).
+     * @param src Posición de inicio.
+     * @param goalId ID del nodo en el que detenerse, o -1 para recorrer toda la componente.
+     * @param blocked Máscara de bloqueo, o nullptr.
+     * @return Distancia hasta goalId, o -1 si no se alcanzó.
+     */
+    int computeBitLayers(Position src, int goalId, const DATA_STRUCTURES::Bitboard* blocked);
+
+    /**
+     * @brief Avanza desde una celda en una dirección hasta el siguiente punto de salto.
+     * @param row Fila de la celda de partida.
+     * @param col Columna de la celda de partida.
+     * @param dRow Desplazamiento de fila de la dirección.
+     * @param dCol Desplazamiento de columna de la dirección.
+     * @param goalId ID del nodo objetivo (siempre es punto de salto).
+     * @param diagonal true para 8-conectividad, false para 4-conectividad.
+     * @return ID del punto de salto, o -1 si el avance choca con un obstáculo o el borde.
+     */
+    int jump(int row, int col, int dRow, int dCol, int goalId, bool diagonal) const;
+
+    /**
+     * @brief Jump Point Search sobre el espacio de trabajo, con A* entre puntos de salto.
+     * @param src Posición de inicio.
+     * @param dest Posición de destino.
+     * @param diagonal true para 8-conectividad, false para 4-conectividad.
+     * @return true si se alcanzó el destino; los padres quedan en el espacio de trabajo.
+     */
+    bool searchJumpPoints(Position src, Position dest, bool diagonal);
 
+    /**
+     * @brief Búsquedas de bfs(), dijkstra(), aStar() y jumpPointSearchDiagonal() sin reconstruir el camino.
+     * @param src Posición de inicio.
+     * @param dest Posición de destino.
+     * @param blocked Máscara de bloqueo, o nullptr.
+     * @return true si se alcanzó el destino; los padres quedan en el espacio de trabajo.
+     */
+    bool searchBfs(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked);
+    bool searchDijkstra(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked);
+    bool searchAStar(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked);
+    bool searchJumpPointsDiagonal(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked);
 
+    const DATA_STRUCTURES::Bitboard* blockingMask = nullptr; ///< Máscara de bloqueo de la Jump Point Search en curso, o nullptr.
 
 public:
+    static constexpr int OCTILE_COUNT = 8; ///< Número de vecinos en 8-conectividad.
+    static constexpr int OCTILE_ROW_OFFSETS[OCTILE_COUNT] = {-1, 1, 0, 0, -1, -1, 1, 1}; ///< Desplazamiento de fila (N, S, E, O, NE, NO, SE, SO).
+    static constexpr int OCTILE_COL_OFFSETS[OCTILE_COUNT] = {0, 0, 1, -1, 1, -1, 1, -1}; ///< Desplazamiento de columna por dirección.
+    static constexpr int STRAIGHT_COST = 70; ///< Coste entero de un paso ortogonal.
+    static constexpr int DIAGONAL_COST = 99; ///< Coste entero de un paso diagonal (~ 70 * sqrt(2)).
+    static constexpr unsigned char FLOW_TARGET = 0xFE; ///< Dirección de flujo de los objetivos.
+    static constexpr unsigned char NO_DIRECTION = 0xFF; ///< Dirección de flujo de las celdas sin camino a ningún objetivo.
+
     /**
      * @brief Constructor del Pathfinder.
+     *
+     * Conviene conservar la instancia entre búsquedas para reutilizar su espacio de trabajo.
+     *
      * @param g Referencia a un GridGraph.
      */
     Pathfinder(GridGraph& g);
@@ -31,44 +108,186 @@ public:
      * @brief Implementación de BFS para encontrar el camino más corto desde un nodo de inicio a un nodo de destino.
      * @param startId Identificador del nodo de inicio.
      * @param goalId Identificador del nodo objetivo.
-     * @return Un vector con los nodos que forman el camino desde el inicio hasta el objetivo.
+     * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+     * @return Camino desde el inicio hasta el objetivo (vacío si no existe).
+     */
+    Path bfs(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+    /**
+     * @brief BFS bidireccional: alterna fronteras desde el inicio y el destino hasta que se encuentran.
+     *
+     * Devuelve caminos de la misma longitud que bfs() expandiendo del orden de dos discos de radio d/2
+     * en lugar de uno de radio d.
+     *
+     * @param src Posición de inicio.
+     * @param dest Posición de destino.
+     * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+     * @return Camino desde el inicio hasta el objetivo (vacío si no existe).
+     */
+    Path bidirectionalBfs(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+    /**
+     * @brief BFS bit-paralela: expande una capa completa por paso con operaciones sobre palabras de 64 bits.
+     * @param src Posición de inicio.
+     * @param dest Posición de destino.
+     * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+     * @return Camino más corto (misma longitud que bfs()), vacío si no existe.
+     */
+    [[nodiscard]] Path bitParallelBfs(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+    /**
+     * @brief Calcula con BFS bit-paralela el campo de distancias desde un origen.
+     * @param src Posición de origen.
+     * @param distances Arreglo de salida (filas x columnas) con -1 en las celdas inalcanzables.
+     * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+     */
+    void bitParallelDistances(Position src, DATA_STRUCTURES::DynamicArray<int>& distances,
+                              const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+    /**
+     * @brief Calcula en un solo barrido la distancia desde la fuente más cercana a todas las celdas.
+     *
+     * Es una BFS que empieza con todas las fuentes en la capa 0, así que cuesta lo mismo que una sola
+     * BFS completa sin importar cuántas fuentes haya. Las fuentes que son obstáculos se ignoran.
+     *
+     * @param sources Posiciones de las fuentes.
+     * @param distances Arreglo de salida (filas x columnas) con -1 en las celdas inalcanzables.
+     * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr; las fuentes nunca lo están.
      */
-    DATA_STRUCTURES::LinkedList<Position> *bfs(Position src, Position dest);
+    void distanceField(const DATA_STRUCTURES::DynamicArray<Position>& sources, DATA_STRUCTURES::DynamicArray<int>& distances,
+                       const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+    /**
+     * @brief Calcula el campo de distancias hacia unos objetivos y la mejor dirección de cada celda.
+     *
+     * La dirección de una celda es un índice de GridGraph::NEIGHBOR_ROW_OFFSETS cuyo vecino está un paso
+     * más cerca del objetivo más cercano; vale FLOW_TARGET en los objetivos y NO_DIRECTION en las celdas sin camino.
+     *
+     * @param targets Posiciones de los objetivos.
+     * @param distances Arreglo de salida (filas x columnas) con la distancia al objetivo más cercano, o -1.
+     * @param directions Arreglo de salida (filas x columnas) con la dirección de cada celda.
+     * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+     */
+    void flowField(const DATA_STRUCTURES::DynamicArray<Position>& targets, DATA_STRUCTURES::DynamicArray<int>& distances,
+                   DATA_STRUCTURES::DynamicArray<unsigned char>& directions, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+    /**
+     * @brief Sigue un campo de flujo desde una celda, con una consulta O(1) por paso.
+     *
+     * @param src Posición de inicio.
+     * @param directions Direcciones calculadas por flowField() con el estado actual del mapa.
+     * @return Camino hasta el objetivo más cercano en el formato de bfs() (vacío si no hay camino).
+     */
+    [[nodiscard]] Path followFlowField(Position src, const DATA_STRUCTURES::DynamicArray<unsigned char>& directions) const;
 
 	/**
 	* @brief Implementación del algoritmo de Dijkstra para encontrar el camino más corto desde un nodo de inicio a un nodo de destino.
 	* @param startId Identificador del nodo de inicio.
 	* @param goalId Identificador del nodo objetivo.
-	* @return Un vector con los nodos que forman el camino más corto desde el inicio hasta el objetivo.
+	* @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+	* @return Camino más corto desde el inicio hasta el objetivo (vacío si no existe).
 	*/
-    DATA_STRUCTURES::LinkedList<Position> *dijkstra(Position src, Position dest);
+    Path dijkstra(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
 
 	/**
 	 * @brief Search for a direct path between two positions.
 	 * @param start Start position.
 	 * @param goal Goal position.
-	 * @return A pointer to queue with the found path or nullptr if there is no linear path.
+	 * @return The path up to the first obstacle, or an empty path if there is no linear path.
 	 */
-	[[nodiscard]] DATA_STRUCTURES::LinkedList<Position> *lineaVista(Position start, Position goal) const;
+	[[nodiscard]] Path lineaVista(Position start, Position goal) const;
 
 	/**
 	 * @brief Metodo que intenta moverse al objetivo utilizando línea de vista y movimiento aleatorio si es necesario.
 	 * @param startId Identificador del nodo de inicio.
 	 * @param goalId Identificador del nodo objetivo.
-	 * @return Un vector con los nodos que forman el camino desde el inicio hasta el objetivo.
+	 * @return Camino recorrido desde el inicio (vacío si no pudo moverse).
 	 */
-    DATA_STRUCTURES::LinkedList<Position> *randomMovement(Position src, Position dest);
+    Path randomMovement(Position src, Position dest);
 
-	[[nodiscard]] DATA_STRUCTURES::LinkedList<Position> *aStar(Position src, Position dest) const;
+	/**
+	 * @brief A* 8-conexo con heurística octil, usado por la precisión de ataque.
+	 * @param src Posición de inicio.
+	 * @param dest Posición de destino.
+	 * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+	 * @return Camino en orden de recorrido, sin incluir el inicio (vacío si no existe).
+	 */
+	[[nodiscard]] Path aStar(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+	/**
+	 * @brief Jump Point Search 4-conexa para el movimiento de los tanques.
+	 *
+	 * Con costes uniformes devuelve caminos de la misma longitud que bfs(), pero solo encola los puntos
+	 * de salto en lugar de cada celda de los caminos simétricos.
+	 *
+	 * @param src Posición de inicio.
+	 * @param dest Posición de destino.
+	 * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+	 * @return Camino desde el inicio hasta el objetivo (vacío si no existe), en el formato de bfs().
+	 */
+	[[nodiscard]] Path jumpPointSearch(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+	/**
+	 * @brief Jump Point Search 8-conexa con las mismas reglas de movimiento y costes que aStar().
+	 * @param src Posición de inicio.
+	 * @param dest Posición de destino.
+	 * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+	 * @return Camino en orden de recorrido, sin incluir el inicio (vacío si no existe), como aStar().
+	 */
+	[[nodiscard]] Path jumpPointSearchDiagonal(Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+	/**
+	 * @brief Ejecuta uno de los algoritmos deterministas; el mismo estado del mapa da siempre el mismo camino.
+	 * @param algorithm Algoritmo a ejecutar.
+	 * @param src Posición de inicio.
+	 * @param dest Posición de destino.
+	 * @param blocked Celdas bloqueadas además de los obstáculos, o nullptr.
+	 * @return Camino en el formato del algoritmo elegido (vacío si no existe).
+	 */
+	[[nodiscard]] Path findPath(PathAlgorithm algorithm, Position src, Position dest, const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+	/**
+	 * @brief Como findPath(), pero añade el camino al final de path en lugar de devolver uno nuevo.
+	 *
+	 * Las posiciones se escriben directamente en la memoria de path, que crece geométricamente: llamarla
+	 * con el mismo camino para varias consultas no reserva memoria una vez alcanzado su tamaño.
+	 *
+	 * @param algorithm Algoritmo a ejecutar.
+	 * @param src Posición de inicio.
+	 * @param dest Posición de destino.
+	 * @param path Camino al que se añaden las posiciones, en el formato del algoritmo elegido.
+	 * @param blocked Máscara de bloqueo, o nullptr.
+	 * @return Número de posiciones añadidas (0 si no hay camino).
+	 */
+	int appendPath(PathAlgorithm algorithm, Position src, Position dest, Path& path,
+	               const DATA_STRUCTURES::Bitboard* blocked = nullptr);
+
+	/**
+	 * @brief Devuelve el número de nodos expandidos por la última búsqueda de bfs(), bidirectionalBfs(),
+	 * dijkstra(), aStar() o Jump Point Search.
+	 */
+	[[nodiscard]] int getExpandedNodeCount() const;
 
 	/**
 	 * @brief Calcula la ruta de la bala considerando rebotes y colisiones.
 	 * @param start Posición inicial de la bala.
 	 * @param end Posición objetivo (donde se hizo clic).
 	 * @param maxBounces Número máximo de rebotes permitidos.
-	 * @return Puntero a LinkedList<Position> con la ruta calculada.
+	 * @return Ruta calculada, empezando en la posición inicial (vacía si start y end coinciden).
+	 */
+	[[nodiscard]] Path calculateBulletPath(Position start, Position end, int maxBounces) const;
+
+	/**
+	 * @brief Calcula la ruta de la bala en un camino existente, reutilizando su memoria.
+	 *
+	 * El coste es proporcional al número de celdas atravesadas; las paredes no se incluyen en la ruta.
+	 *
+	 * @param start Posición inicial de la bala.
+	 * @param end Posición objetivo (donde se hizo clic).
+	 * @param maxBounces Número máximo de rebotes permitidos.
+	 * @param path Camino de salida; se vacía antes de rellenarlo.
 	 */
-	DATA_STRUCTURES::LinkedList<Position>* calculateBulletPath(Position start, Position end, int maxBounces) const;
+	void calculateBulletPath(Position start, Position end, int maxBounces, Path& path) const;
 
 };
 
@@ -0,0 +1,168 @@
+#ifndef SEARCHWORKSPACE_H
+#define SEARCHWORKSPACE_H
+
+#include <algorithm>
+#include <limits>
+#include "data_structures/Bitboard.h"
+#include "data_structures/DynamicArray.h"
+#include "data_structures/IndexedPriorityQueue.h"
+#include "data_structures/Pair.h"
+#include "data_structures/PriorityQueue.h"
+
+/**
+ * @brief Memoria de trabajo reutilizable para las búsquedas de caminos.
+ *
+ * Las marcas de visitado, los padres y las distancias no se limpian entre búsquedas: cada entrada lleva
+ * la generación en la que se escribió y solo es válida si coincide con la generación actual. Iniciar una
+ * búsqueda cuesta O(1) y una consulta corta solo toca las celdas que explora.
+ *
+ * Los planos de la BFS bit-paralela no llevan generación: se limpian al iniciar la búsqueda siguiente,
+ * pero solo en las filas que tocó la anterior.
+ */
+class SearchWorkspace {
+private:
+    DATA_STRUCTURES::DynamicArray<unsigned int> stamp; ///< Generación en la que se tocó cada nodo.
+    DATA_STRUCTURES::DynamicArray<int> parent; ///< Padre de cada nodo (válido si stamp coincide).
+    DATA_STRUCTURES::DynamicArray<int> distance; ///< Distancia de cada nodo (válida si stamp coincide).
+    unsigned int generation = 0; ///< Generación de la búsqueda actual.
+    int touchedFirstRow = 0; ///< Primera fila de los planos escrita por la última BFS bit-paralela.
+    int touchedLastRow = -1; ///< Última fila de los planos escrita por la última BFS bit-paralela (-1 si ninguna).
+
+public:
+    static constexpr int INF = std::numeric_limits<int>::max(); ///< Distancia de los nodos no alcanzados.
+
+    DATA_STRUCTURES::DynamicArray<int> queue; ///< Cola FIFO de BFS; cada nodo entra como mucho una vez.
+    PriorityQueue<Pair<int, int>> heap; ///< Cola de prioridad de pares (distancia, nodo) para Dijkstra.
+    DATA_STRUCTURES::IndexedPriorityQueue<long long> open; ///< Lista abierta de A*, con una entrada por nodo.
+    DATA_STRUCTURES::Bitboard layers[2]; ///< Frontera y capa siguiente de la BFS bit-paralela, que se alternan.
+    DATA_STRUCTURES::Bitboard reached; ///< Celdas alcanzadas por la BFS bit-paralela.
+    DATA_STRUCTURES::DynamicArray<int> layerDistance; ///< Distancia de la BFS bit-paralela, -1 si no se alcanzó.
+
+    /**
+     * @brief Prepara una nueva búsqueda sobre un grafo de nodeCount nodos.
+     *
+     * Solo recorre los arreglos cuando cambia el tamaño del grafo o cuando el contador de generaciones
+     * da la vuelta.
+     *
+     * @param nodeCount Número de nodos del grafo.
+     */
+    void begin(int nodeCount);
+
+    /**
+     * @brief Prepara una nueva BFS bit-paralela sobre un mapa de rows x cols.
+     *
+     * Deja layers, reached y layerDistance limpios limpiando solo las filas que registró touchRows()
+     * desde la llamada anterior; los recorre completos solo cuando cambian las dimensiones.
+     *
+     * @param rows Número de filas del mapa.
+     * @param cols Número de columnas del mapa.
+     */
+    void beginLayers(int rows, int cols);
+
+    /**
+     * @brief Registra que la BFS bit-paralela actual escribió en las filas [first, last] de los planos.
+     */
+    void touchRows(int first, int last);
+
+    /**
+     * @brief Verifica si un nodo ya fue alcanzado en la búsqueda actual.
+     * @param id ID del nodo.
+     */
+    bool isVisited(int id) const;
+
+    /**
+     * @brief Marca un nodo como alcanzado y registra su padre y su distancia.
+     * @param id ID del nodo.
+     * @param parentId ID del padre (-1 para el origen).
+     * @param dist Distancia desde el origen.
+     */
+    void visit(int id, int parentId, int dist);
+
+    /**
+     * @brief Devuelve el padre de un nodo en la búsqueda actual (-1 si no fue alcanzado).
+     * @param id ID del nodo.
+     */
+    int getParent(int id) const;
+
+    /**
+     * @brief Devuelve la distancia de un nodo en la búsqueda actual (INF si no fue alcanzado).
+     * @param id ID del nodo.
+     */
+    int getDistance(int id) const;
+};
+
+inline void SearchWorkspace::begin(const int nodeCount) {
+    if (stamp.size() != nodeCount) {
+        stamp.resize(nodeCount);
+        parent.resize(nodeCount);
+        distance.resize(nodeCount);
+        queue.resize(nodeCount);
+        for (int i = 0; i < nodeCount; ++i) {
+            stamp[i] = 0;
+        }
+        generation = 0;
+    }
+
+    // La generación 0 está reservada para "nunca tocado"; al dar la vuelta se limpian las marcas
+    if (++generation == 0) {
+        for (int i = 0; i < nodeCount; ++i) {
+            stamp[i] = 0;
+        }
+        generation = 1;
+    }
+
+    heap.clear();
+    open.reset(nodeCount);
+}
+
+inline void SearchWorkspace::beginLayers(const int rows, const int cols) {
+    if (reached.getRows() != rows || reached.getCols() != cols) {
+        layers[0] = DATA_STRUCTURES::Bitboard(rows, cols);
+        layers[1] = DATA_STRUCTURES::Bitboard(rows, cols);
+        reached = DATA_STRUCTURES::Bitboard(rows, cols);
+        layerDistance.resize(rows * cols);
+        for (int i = 0; i < rows * cols; ++i) {
+            layerDistance[i] = -1;
+        }
+    } else {
+        for (int r = touchedFirstRow; r <= touchedLastRow; ++r) {
+            for (DATA_STRUCTURES::Bitboard* board : {&layers[0], &layers[1], &reached}) {
+                DATA_STRUCTURES::Bitboard::Word* rowWords = board->row(r);
+                for (int w = 0; w < board->getWordsPerRow(); ++w) {
+                    rowWords[w] = 0;
+                }
+            }
+            for (int c = 0; c < cols; ++c) {
+                layerDistance[r * cols + c] = -1;
+            }
+        }
+    }
+
+    touchedFirstRow = rows;
+    touchedLastRow = -1;
+}
+
+inline void SearchWorkspace::touchRows(const int first, const int last) {
+    touchedFirstRow = std::min(touchedFirstRow, first);
+    touchedLastRow = std::max(touchedLastRow, last);
+}
+
+inline bool SearchWorkspace::isVisited(const int id) const {
+    return stamp[id] == generation;
+}
+
+inline void SearchWorkspace::visit(const int id, const int parentId, const int dist) {
+    stamp[id] = generation;
+    parent[id] = parentId;
+    distance[id] = dist;
+}
+
+inline int SearchWorkspace::getParent(const int id) const {
+    return stamp[id] == generation ? parent[id] : -1;
+}
+
+inline int SearchWorkspace::getDistance(const int id) const {
+    return stamp[id] == generation ? distance[id] : INF;
+}
+
+#endif // SEARCHWORKSPACE_H
@@ -50,7 +50,7 @@ Bullet *Controller::getBullet() const {
     return model->getBullet();
 }
 
-LinkedList<Position> *Controller::getBulletPath() const {
+Path& Controller::getBulletPath() const {
     return model->getBulletPath();
 }
 
@@ -91,8 +91,12 @@ void Controller::handlePowerUpActivation() const {
     model->handlePowerUpActivation();
 }
 
+void Controller::cycleBfsMode() const {
+    model->cycleBfsMode();
+}
+
 
-LinkedList<Position> *Controller::getTankPath() const {
+Path& Controller::getTankPath() const {
     return model->getTankPath();
 }
 
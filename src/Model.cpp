@@ -1,4 +1,5 @@
 #include "Model.h"
+#include <chrono>
 #include <random>
 #include <View.h>
 #include <systems/Pathfinder.h>
@@ -93,14 +94,13 @@ void Model::handleMoveTank(const Tank* tank, const Position dest) {
     // Calculate path
     const auto src = Position{tank->getRow(), tank->getColumn()};
     tankPath = calculatePath(tank->getColor(), playerPowerUp, src, dest);
+    tankPlanner->clear(); // A new move starts a new plan on its first blocked step
 
     // Decrement actions remaining
     decreaseActions();
 }
 
-LinkedList<Position>* Model::calculatePath(const Color color, const POWER_UP powerUp, Position src, Position dest) const {
-    Pathfinder pathfinder(*getMap());
-
+Path Model::calculatePath(const Color color, const POWER_UP powerUp, Position src, Position dest) const {
     static std::random_device rd;
     static std::mt19937 gen(rd());
     std::uniform_int_distribution<> dist(1, 10);
@@ -108,20 +108,121 @@ LinkedList<Position>* Model::calculatePath(const Color color, const POWER_UP pow
 
     const int probability = calculateProbability(color, powerUp);
 
+    // Tank moves route around the other tanks instead of stopping in front of them
+    const DATA_STRUCTURES::Bitboard* tanks = &map->getOccupiedBoard();
     if (color == Red || color == Yellow) {
         if (randomNumber <= probability) {
-            std::cout << "Se está usando BFS" << std::endl;
-            return pathfinder.bfs(src, dest);
+            if (bfsMode == BfsMode::BitParallel) {
+                std::cout << "Se está usando BFS bit-paralela" << std::endl;
+                return pathfinder->bitParallelBfs(src, dest, tanks);
+            }
+            if (bfsMode == BfsMode::JumpPoint) {
+                std::cout << "Se está usando Jump Point Search" << std::endl;
+                return pathfinder->jumpPointSearch(src, dest, tanks);
+            }
+            if (bfsMode == BfsMode::Hierarchical) {
+                // HPA* ignores the tanks, so a path through one falls back to the masked search
+                std::cout << "Se está usando búsqueda jerárquica (HPA*)" << std::endl;
+                Path path = hierarchicalPathfinder->findPath(src, dest);
+                if (!crossesMask(path, tanks)) {
+                    return path;
+                }
+                return shortestPath(PathAlgorithm::Bfs, src, dest, tanks);
+            }
+            return shortestPath(PathAlgorithm::Bfs, src, dest, tanks);
         }
     } else {
         if (randomNumber <= probability) {
-            std::cout << "Se está usando Dijkstra" << std::endl;
-            return pathfinder.dijkstra(src, dest);
+            return shortestPath(PathAlgorithm::Dijkstra, src, dest, tanks);
         }
     }
     std::cout << "Se está usando Random Movement" << std::endl;
-    return pathfinder.randomMovement(src, dest);
+    return pathfinder->randomMovement(src, dest);
+
+}
+
+void Model::setBfsMode(const BfsMode mode) {
+    bfsMode = mode;
+}
+
+void Model::cycleBfsMode() {
+    switch (bfsMode) {
+        case BfsMode::Queue:
+            bfsMode = BfsMode::BitParallel;
+            std::cout << "Modo BFS: bit-paralela" << std::endl;
+            break;
+        case BfsMode::BitParallel:
+            bfsMode = BfsMode::JumpPoint;
+            std::cout << "Modo BFS: Jump Point Search" << std::endl;
+            break;
+        case BfsMode::JumpPoint:
+            bfsMode = BfsMode::Hierarchical;
+            std::cout << "Modo BFS: jerárquica (HPA*)" << std::endl;
+            break;
+        case BfsMode::Hierarchical:
+            bfsMode = BfsMode::Queue;
+            std::cout << "Modo BFS: cola" << std::endl;
+            break;
+    }
+}
 
+BfsMode Model::getBfsMode() const {
+    return bfsMode;
+}
+
+const PathCache* Model::getPathCache() const {
+    return pathCache;
+}
+
+Path Model::shortestPath(const PathAlgorithm algorithm, const Position src, const Position dest,
+                         const DATA_STRUCTURES::Bitboard* blocked) const {
+    std::cout << (algorithm == PathAlgorithm::Dijkstra ? "Se está usando Dijkstra" : "Se está usando BFS") << std::endl;
+
+    // The cache sits in front of the table too, so every repeated move counts as a hit
+    if (const Path* cached = pathCache->find(algorithm, src, dest, blocked)) {
+        return *cached;
+    }
+
+    // The precomputed table ignores the tanks, so its path is only used when it does not run through one
+    Path path;
+    if (nextHopTable->isValid()) {
+        path = nextHopTable->getPath(src, dest);
+        if (crossesMask(path, blocked)) {
+            path = pathfinder->findPath(algorithm, src, dest, blocked);
+        } else {
+            std::cout << "Se está usando la tabla de siguiente salto" << std::endl;
+        }
+    } else {
+        path = pathfinder->findPath(algorithm, src, dest, blocked);
+    }
+
+    pathCache->store(algorithm, src, dest, path, blocked);
+    return path;
+}
+
+bool Model::crossesMask(const Path& path, const DATA_STRUCTURES::Bitboard* blocked) {
+    if (blocked == nullptr) {
+        return false;
+    }
+
+    // The first position is the moving tank itself
+    for (int i = 1; i < path.size(); ++i) {
+        if (blocked->test(path[i].row, path[i].column)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Path Model::cachedSearch(const PathAlgorithm algorithm, const Position src, const Position dest,
+                         const DATA_STRUCTURES::Bitboard* blocked) const {
+    if (const Path* cached = pathCache->find(algorithm, src, dest, blocked)) {
+        return *cached;
+    }
+
+    Path path = pathfinder->findPath(algorithm, src, dest, blocked);
+    pathCache->store(algorithm, src, dest, path, blocked);
+    return path;
 }
 
 int Model::calculateProbability(const Color color, const POWER_UP powerUp) const {
@@ -148,7 +249,7 @@ Bullet* Model::getBullet() const {
     return bullet;
 }
 
-LinkedList<Position>* Model::getBulletPath() const {
+Path& Model::getBulletPath() {
     return bulletPath;
 }
 
@@ -158,7 +259,7 @@ void Model::handleFireBullet(const Position src, const Position dest) {
     // Create bullet
     createBullet(src, dest, powerUp);
 
-    if (bulletPath == nullptr) {
+    if (bulletPath.empty()) {
         destroyBullet();
         return;
     }
@@ -194,6 +295,7 @@ bool Model::tankKilled(const Tank* tank) {
 void Model::handleTankDestruction(Tank* tank) const {
     tank->destroy();
     map->removeTank(tank->getRow(), tank->getColumn());
+    tankPlanner->cellChanged(tank->getRow(), tank->getColumn());
 }
 
 void Model::createBullet(const Position src, const Position dest, const POWER_UP powerUp) {
@@ -205,30 +307,26 @@ void Model::createBullet(const Position src, const Position dest, const POWER_UP
     }
 
     // Calculate bullet path
-    const Pathfinder pathfinder(*map);
-
     if (powerUp == ATTACK_PRECISION && currentPlayer->getPowerUpActive()) {
-        bulletPath = pathfinder.aStar(src, dest);
-        bulletPath->reverse();
+        // 8-connected Jump Point Search: same moves and costs as A*, but only jump points are expanded
+        bulletPath = cachedSearch(PathAlgorithm::JumpPointDiagonal, src, dest);
         currentPlayer->erasePowerUp();
     } else {
-        bulletPath = pathfinder.calculateBulletPath(src, dest, 4); // 4 rebotes máximos
+        pathfinder->calculateBulletPath(src, dest, 4, bulletPath); // 4 rebotes máximos
     }
 }
 
 void Model::destroyBullet() {
     delete bullet;
-    delete bulletPath;
     bullet = nullptr;
-    bulletPath = nullptr;
+    bulletPath.clear();
 }
 
 void Model::destroyTankPath() {
-    delete tankPath;
-    tankPath = nullptr;
+    tankPath.clear();
 }
 
-LinkedList<Position> *Model::getTankPath() const {
+Path& Model::getTankPath() {
     return tankPath;
 }
 
@@ -236,18 +334,50 @@ void Model::setCurrentPlayer(Player* player) {
     currentPlayer = player;
 }
 
-void Model::moveTank(Tank* tank, const Position position) const {
+void Model::moveTank(Tank* tank, Position position) {
     if (tank->isSelected()) {
+        const Position current{tank->getRow(), tank->getColumn()};
+
+        // Random moves ignore the other tanks, so a step into one is replaced by a repaired detour
+        if (!(position == current) && !tankPath.empty()
+            && (map->isObstacle(position.row, position.column) || map->isOccupied(position.row, position.column))) {
+            position = repairTankPath(current);
+        }
+
         if (!map->isObstacle(position.row, position.column)
             && !map->isOccupied(position.row, position.column)) {
             map->removeTank(tank->getRow(), tank->getColumn());
             map->placeTank(position.row, position.column);
+            tankPlanner->cellChanged(current.row, current.column);
+            tankPlanner->cellChanged(position.row, position.column);
+            tankPlanner->moveStart(position);
 
             tank->setPosition(position);
         }
     }
 }
 
+Position Model::repairTankPath(const Position current) {
+    const Position goal = tankPath.back();
+    if (tankPlanner->isPlanning(goal)) {
+        tankPlanner->moveStart(current);
+    } else {
+        tankPlanner->plan(current, goal);
+    }
+
+    Path detour = tankPlanner->getPath();
+    if (detour.size() < 2) {
+        tankPath.clear(); // The view sees a finished path on its next step
+        return current;
+    }
+
+    // The view advances the cursor after this step, so leave it on the step taken now
+    tankPath = std::move(detour);
+    tankPath.rewind();
+    tankPath.advance();
+    return tankPath[1];
+}
+
 void Model::generatePowerUps() const {
     for (int i = 0; i < 2; i++) {
         players[i].generatePowerUp();
@@ -322,7 +452,19 @@ void Model::setGameOver(const bool gameOver) {
 void Model::createMap() {
     map = new GridGraph();
     map->generateObstacles();
-    map->connectNodes();
+    pathfinder = new Pathfinder(*map);
+    hierarchicalPathfinder = new HierarchicalPathfinder(*map); // Clusters are built on the first query
+    pathCache = new PathCache(*map);
+    tankPlanner = new DStarLite(*map);
+
+    // Precompute all-pairs shortest paths; skipped automatically on maps above the table's cell limit
+    nextHopTable = new NextHopTable(*map);
+    const auto start = std::chrono::steady_clock::now();
+    if (nextHopTable->build()) {
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        std::cout << "Tabla de siguiente salto: " << nextHopTable->getMemoryUsage() / 1024 << " KB en "
+                  << elapsed.count() << " ms" << std::endl;
+    }
 }
 
 void Model::createPlayers() {
@@ -77,7 +77,8 @@ GtkWidget* View::createHBox(GtkWidget *vbox) {
 void View::createDrawingArea(GtkWidget *hbox) {
     drawingArea = gtk_drawing_area_new();
 
-    gtk_widget_set_size_request(drawingArea, COLS * CELL_SIZE, ROWS * CELL_SIZE);
+    const GridGraph* gridMap = controller->getMap();
+    gtk_widget_set_size_request(drawingArea, gridMap->getCols() * CELL_SIZE, gridMap->getRows() * CELL_SIZE);
     gtk_box_pack_start(GTK_BOX(hbox), drawingArea, FALSE, FALSE, 0);
 
     gtk_widget_set_can_focus(drawingArea, TRUE); // Ensure the widget can receive focus
@@ -184,9 +185,9 @@ gboolean View::onDraw(GtkWidget *widget, cairo_t *cr, gpointer data) {
 void View::drawMap(cairo_t *cr) {
     const GridGraph* gridMap = controller->getMap();
 
-    for (int row = 0; row < ROWS; ++row) {
-        for (int col = 0; col < COLS; ++col) {
-            const Node& node = gridMap->getNode(row, col);
+    for (int row = 0; row < gridMap->getRows(); ++row) {
+        for (int col = 0; col < gridMap->getCols(); ++col) {
+            const Node node = gridMap->getNode(row, col);
 
             // Get the cell image
             const GdkPixbuf* pixbuf = selectCellImage(node);
@@ -199,14 +200,14 @@ void View::drawMap(cairo_t *cr) {
 }
 
 void View::drawTankPath(cairo_t *cr) const {
-    LinkedList<Position>* trace = controller->getTankPath();
-    if (trace == nullptr) {
+    const Path& trace = controller->getTankPath();
+    if (trace.empty()) {
         return;
     }
 
     cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
-    for (int i = 0; i < trace->size(); i++) {
-        const auto [row, col] = trace->at(i);
+    for (int i = 0; i < trace.size(); i++) {
+        const auto [row, col] = trace.at(i);
 
         const double x = col * CELL_SIZE + CELL_SIZE / 2;
         const double y = row * CELL_SIZE + CELL_SIZE / 2;
@@ -398,12 +399,12 @@ GtkWidget* View::createPowerUpLabel(const int playerId) const {
 void View::drawBulletTrace(cairo_t *cr) const {
     if (const Bullet* bullet = controller->getBullet();
         bullet != nullptr) {
-        if (const LinkedList<Position>* trace = controller->getBulletPath();
-            trace != nullptr && !trace->empty()) {
+        if (const Path& trace = controller->getBulletPath();
+            !trace.empty()) {
             cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
 
-            for (int i = 0; i < trace->size(); i++) {
-                const auto [row, column] = trace->at(i);
+            for (int i = 0; i < trace.size(); i++) {
+                const auto [row, column] = trace.at(i);
 
                 const double x = column * CELL_SIZE + (CELL_SIZE - TRACE_SIZE) / 2;
                 const double y = row * CELL_SIZE + (CELL_SIZE - TRACE_SIZE) / 2;
@@ -478,12 +479,13 @@ gboolean View::onClick(GtkWidget* widget, const GdkEventButton* event, gpointer
     if (event->button == 1) {
         if (Tank* clickedTank = controller->getTankOnPosition(position)) {
             controller->handleSelectTank(clickedTank);
-        } else if (cellClicked(position)) {
+        } else if (view->cellClicked(position)) {
             if (Tank* selectedTank = controller->getSelectedTank()) {
                 controller->handleMoveTank(selectedTank, position);
 
-                LinkedList<Position>* path = controller->getTankPath();
-                auto* moveData = new MoveData{view, selectedTank, path};
+                Path& path = controller->getTankPath();
+                path.rewind();
+                auto* moveData = new MoveData{view, selectedTank, &path};
                 view->moveSoundChannel = view->soundManager.playSoundEffect(SoundEffectType::Move, -1);
                 g_timeout_add(100, moveTankStep, moveData);
             }
@@ -496,8 +498,9 @@ gboolean View::onClick(GtkWidget* widget, const GdkEventButton* event, gpointer
             }
             controller->handleFireBullet(Position(selectedTank->getRow(), selectedTank->getColumn()), position);
 
-            LinkedList<Position>* path = controller->getBulletPath();
-            auto* moveData = new MoveData{view, selectedTank, path, 0};
+            Path& path = controller->getBulletPath();
+            path.rewind();
+            auto* moveData = new MoveData{view, selectedTank, &path};
             view->soundManager.playSoundEffect(SoundEffectType::Fire);
             g_timeout_add(100, moveBulletStep, moveData);
             selectedTank->setSelected(false);
@@ -512,10 +515,9 @@ gboolean View::moveTankStep(gpointer data) {
     auto* moveData = static_cast<MoveData*>(data);
     View* view = moveData->view;
     Tank* tank = moveData->tank;
-    const int currentStep = moveData->currentStep;
-    const LinkedList<Position>* path = moveData->path;
+    Path* path = moveData->path;
 
-    if (path->size() == currentStep) {
+    if (path->finished()) {
         tank->setSelected(false);
 
         // Stop Sound Effect
@@ -531,14 +533,14 @@ gboolean View::moveTankStep(gpointer data) {
         return FALSE;
     }
 
-    auto [row, col] = path->at(currentStep);
+    auto [row, col] = path->current();
 
     setTankRotationAngle(tank, row, col);
 
     const auto newPosition = Position(row, col);
     view->controller->moveTank(tank, newPosition);
 
-    moveData->currentStep++;
+    path->advance();
     view->update();
 
     return TRUE;
@@ -568,12 +570,12 @@ void View::setTankRotationAngle(Tank* tank, const int destRow, const int destCol
 gboolean View::moveBulletStep(gpointer data) {
     auto* moveData = static_cast<MoveData*>(data);
     auto* view = moveData->view;
-    const int currentStep = moveData->currentStep;
     const auto* controller = view->controller;
-    const LinkedList<Position>* path = moveData->path;
+    Path* path = moveData->path;
+    const int currentStep = path->getCursor();
     Bullet* bullet = controller->getBullet();
 
-    if (path == nullptr) { // No path
+    if (path->empty()) { // No path
         return FALSE;
     }
 
@@ -585,14 +587,14 @@ gboolean View::moveBulletStep(gpointer data) {
         return FALSE;
     }
 
-    if (path->size() == currentStep) { // Movement finished
+    if (path->finished()) { // Movement finished
         controller->destroyBullet();
 
         view->update();
         return FALSE;
     }
 
-    auto [row, col] = path->at(currentStep);
+    auto [row, col] = path->current();
 
     setBulletRotationAngle(bullet, row, col);
 
@@ -617,7 +619,7 @@ gboolean View::moveBulletStep(gpointer data) {
         }
     }
 
-    moveData->currentStep++;
+    path->advance();
     view->update();
 
     return TRUE;
@@ -686,6 +688,8 @@ gboolean View::onKeyPress(GtkWidget* widget, GdkEventKey* event, gpointer data)
     if (event->keyval == GDK_KEY_Shift_L || event->keyval == GDK_KEY_Shift_R) {
         controller->handlePowerUpActivation();
         view->update();
+    } else if (event->keyval == GDK_KEY_b || event->keyval == GDK_KEY_B) {
+        controller->cycleBfsMode();
     }
 
     return FALSE;
@@ -696,8 +700,8 @@ gboolean View::onKeyPress(GtkWidget* widget, GdkEventKey* event, gpointer data)
 //     bullet->setDirection(Direction(-x, -y));
 // }
 
-bool View::cellClicked(const Position position) {
-    return position.row >= 0 && position.row < ROWS && position.column >= 0 && position.column < COLS;
+bool View::cellClicked(const Position position) const {
+    return controller->getMap()->isValid(position.row, position.column);
 }
 
 // bool View::BulletHitWall(const Bullet* bullet) const {
@@ -0,0 +1,185 @@
+#include "systems/BatchPathfinder.h"
+#include <algorithm>
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    constexpr int RANGE_SHIFT = 32; ///< Desplazamiento de la primera consulta dentro de Worker::range.
+    constexpr unsigned long long RANGE_MASK = 0xFFFFFFFFULL; ///< Máscara del fin del bloque dentro de Worker::range.
+
+    unsigned long long packRange(const int first, const int end) {
+        return static_cast<unsigned long long>(first) << RANGE_SHIFT | static_cast<unsigned int>(end);
+    }
+}
+
+Path PathBatch::getPath(const int query) const {
+    Path path(getLength(query));
+    for (int step = 0; step < path.size(); ++step) {
+        path[step] = at(query, step);
+    }
+    return path;
+}
+
+BatchPathfinder::BatchPathfinder(GridGraph& graph, int threadCount) : graph(graph) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; ++i) {
+        workers.push_back(std::make_unique<Worker>(graph));
+    }
+
+    threads.reserve(threadCount - 1);
+    for (int i = 1; i < threadCount; ++i) {
+        threads.emplace_back(&BatchPathfinder::serve, this, i);
+    }
+}
+
+BatchPathfinder::~BatchPathfinder() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Reclama la siguiente consulta del bloque propio o, si está vacío, roba una de otro hilo.
+ *
+ * El inicio y el fin de cada bloque comparten una palabra atómica: el dueño avanza el inicio y los
+ * ladrones retroceden el fin con compare-exchange, así que la última consulta de un bloque la reclama
+ * exactamente un hilo sin necesidad de cerrojos.
+ */
+int BatchPathfinder::claim(const int self) {
+    const int threadCount = static_cast<int>(workers.size());
+    for (int offset = 0; offset < threadCount; ++offset) {
+        const int victim = (self + offset) % threadCount;
+        std::atomic<unsigned long long>& range = workers[victim]->range;
+        unsigned long long current = range.load();
+        while (true) {
+            const int first = static_cast<int>(current >> RANGE_SHIFT);
+            const int end = static_cast<int>(current & RANGE_MASK);
+            if (first >= end) {
+                break;
+            }
+            const bool own = victim == self;
+            const unsigned long long updated = own ? packRange(first + 1, end) : packRange(first, end - 1);
+            if (range.compare_exchange_weak(current, updated)) {
+                if (!own) {
+                    ++steals;
+                }
+                return own ? first : end - 1;
+            }
+        }
+    }
+    return -1;
+}
+
+void BatchPathfinder::work(const int self, const DynamicArray<PathQuery>& queries) {
+    Worker& worker = *workers[self];
+    for (int query = claim(self); query != -1; query = claim(self)) {
+        const PathQuery& request = queries[query];
+        owner[query] = self;
+        localStart[query] = worker.arena.size();
+        lengths[query] = worker.pathfinder.appendPath(request.algorithm, request.src, request.dest, worker.arena,
+                                                      request.blocked);
+    }
+}
+
+/**
+ * @brief Bucle de un hilo del grupo.
+ *
+ * Duerme hasta que se publica un lote con un número distinto del último que resolvió; los bloques ya
+ * están escritos cuando se publica, así que el cerrojo solo protege el número de lote y el contador.
+ */
+void BatchPathfinder::serve(const int self) {
+    unsigned long served = 0;
+    while (true) {
+        const DynamicArray<PathQuery>* queries;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || batchNumber != served; });
+            if (stopping) {
+                return;
+            }
+            served = batchNumber;
+            queries = batch;
+        }
+
+        work(self, *queries);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--running == 0) {
+            finished.notify_one();
+        }
+    }
+}
+
+/**
+ * @brief Resuelve un lote de consultas.
+ *
+ * Las consultas se reparten en bloques contiguos, uno por hilo, y cada hilo guarda sus caminos en su
+ * propia memoria. Al terminar, una suma prefija de las longitudes fija la posición de cada camino y
+ * se copian todos, en el orden de las consultas, al arreglo contiguo de results.
+ */
+void BatchPathfinder::findPaths(const DynamicArray<PathQuery>& queries, PathBatch& results) {
+    const int queryCount = queries.size();
+    owner.resize(queryCount);
+    localStart.resize(queryCount);
+    lengths.resize(queryCount);
+    steals = 0;
+
+    // Las búsquedas consultan las componentes conexas; se etiquetan aquí para que los hilos solo lean
+    (void)graph.getComponentCount();
+
+    const int threadCount = std::min(static_cast<int>(workers.size()), std::max(queryCount, 1));
+    for (int i = 0; i < static_cast<int>(workers.size()); ++i) {
+        const int first = i < threadCount ? static_cast<int>(static_cast<long long>(queryCount) * i / threadCount) : 0;
+        const int end = i < threadCount ? static_cast<int>(static_cast<long long>(queryCount) * (i + 1) / threadCount) : 0;
+        workers[i]->range = packRange(first, end);
+        workers[i]->arena.clear();
+    }
+
+    if (threadCount <= 1) {
+        work(0, queries);
+    } else {
+        // Todos los hilos del grupo despiertan; los que no tienen bloque propio solo roban
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            batch = &queries;
+            running = static_cast<int>(threads.size());
+            ++batchNumber;
+        }
+        wake.notify_all();
+        work(0, queries);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] { return running == 0; });
+    }
+
+    results.offsets.resize(queryCount + 1);
+    results.offsets[0] = 0;
+    for (int query = 0; query < queryCount; ++query) {
+        results.offsets[query + 1] = results.offsets[query] + lengths[query];
+    }
+    results.positions.resize(results.offsets[queryCount]);
+    for (int query = 0; query < queryCount; ++query) {
+        const Path& arena = workers[owner[query]]->arena;
+        const int start = localStart[query];
+        const int offset = results.offsets[query];
+        for (int step = 0; step < lengths[query]; ++step) {
+            results.positions[offset + step] = arena[start + step];
+        }
+    }
+}
+
+int BatchPathfinder::getThreadCount() const {
+    return static_cast<int>(workers.size());
+}
+
+long BatchPathfinder::getStealCount() const {
+    return steals;
+}
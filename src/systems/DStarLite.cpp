@@ -0,0 +1,249 @@
+#include "systems/DStarLite.h"
+#include <algorithm>
+#include <cstdlib>
+
+using namespace DATA_STRUCTURES;
+
+DStarLite::DStarLite(const GridGraph& graph) : graph(graph) {}
+
+bool DStarLite::isBlocked(const int id) const {
+    const int row = id / graph.getCols();
+    const int col = id % graph.getCols();
+    return graph.isObstacle(row, col) || (id != startId && graph.isOccupied(row, col));
+}
+
+int DStarLite::heuristic(const int a, const int b) const {
+    const int cols = graph.getCols();
+    return std::abs(a / cols - b / cols) + std::abs(a % cols - b % cols);
+}
+
+unsigned long DStarLite::graphVersion() const {
+    return graph.getMapVersion() + graph.getOccupancyVersion();
+}
+
+int DStarLite::getG(const int id) const {
+    return stamp[id] == generation ? g[id] : INF;
+}
+
+int DStarLite::getRhs(const int id) const {
+    return stamp[id] == generation ? rhs[id] : INF;
+}
+
+void DStarLite::touch(const int id) {
+    if (stamp[id] != generation) {
+        stamp[id] = generation;
+        g[id] = INF;
+        rhs[id] = INF;
+    }
+}
+
+long long DStarLite::calculateKey(const int id) const {
+    const int best = std::min(getG(id), getRhs(id));
+    return static_cast<long long>(best + heuristic(startId, id) + keyModifier) << 32 | best;
+}
+
+/**
+ * @brief Recalcula rhs de un nodo a partir de sus sucesores y lo coloca o lo quita de la cola.
+ *
+ * Un nodo bloqueado no tiene sucesores y tampoco puede ser sucesor de otro, así que su rhs es INF y no
+ * aporta nada a sus vecinos.
+ */
+void DStarLite::updateVertex(const int id) {
+    touch(id);
+    if (id != goalId) {
+        int best = INF;
+        if (!isBlocked(id)) {
+            const unsigned char mask = graph.getNeighborMask(id);
+            for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+                if (!(mask & (1 << direction))) {
+                    continue;
+                }
+                const int neighbor = graph.getNeighborId(id, direction);
+                const int neighborG = getG(neighbor);
+                if (neighborG < INF && neighborG + 1 < best && !isBlocked(neighbor)) {
+                    best = neighborG + 1;
+                }
+            }
+        }
+        rhs[id] = best;
+    }
+
+    if (g[id] != rhs[id]) {
+        open.update(id, calculateKey(id));
+    } else {
+        open.remove(id);
+    }
+}
+
+/**
+ * @brief Procesa nodos inconsistentes hasta que el inicio es consistente y tiene la menor clave.
+ *
+ * Un nodo sobreconsistente (g > rhs) fija su distancia y la propaga a sus vecinos; uno subconsistente
+ * (g < rhs), que aparece cuando una celda se bloquea, olvida su distancia y se reevalúa junto a ellos.
+ */
+void DStarLite::computeShortestPath() {
+    while (!open.empty()) {
+        const int current = open.top();
+        const long long oldKey = open.getKey(current);
+        if (!(oldKey < calculateKey(startId)) && getRhs(startId) == getG(startId)) {
+            break;
+        }
+        ++expandedNodes;
+
+        const long long newKey = calculateKey(current);
+        if (oldKey < newKey) {
+            open.update(current, newKey);
+            continue;
+        }
+
+        if (g[current] > rhs[current]) {
+            g[current] = rhs[current];
+            open.remove(current);
+        } else {
+            g[current] = INF;
+            updateVertex(current);
+        }
+
+        const unsigned char mask = graph.getNeighborMask(current);
+        for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+            if (mask & (1 << direction)) {
+                updateVertex(graph.getNeighborId(current, direction));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Empieza un plan nuevo hacia goalId desde startId.
+ *
+ * Las marcas por generación dejan todos los nodos en INF en O(1), así que reiniciar no recorre el mapa.
+ */
+void DStarLite::restart() {
+    const int nodeCount = graph.getRows() * graph.getCols();
+    if (stamp.size() != nodeCount) {
+        g.resize(nodeCount);
+        rhs.resize(nodeCount);
+        stamp.resize(nodeCount);
+        for (int i = 0; i < nodeCount; ++i) {
+            stamp[i] = 0;
+        }
+        generation = 0;
+    }
+
+    // La generación 0 está reservada para "nunca tocado"; al dar la vuelta se limpian las marcas
+    if (++generation == 0) {
+        for (int i = 0; i < nodeCount; ++i) {
+            stamp[i] = 0;
+        }
+        generation = 1;
+    }
+
+    open.reset(nodeCount);
+    keyModifier = 0;
+    lastStartId = startId;
+    changedCells.clear();
+    syncedVersion = graphVersion();
+
+    touch(goalId);
+    rhs[goalId] = 0;
+    open.update(goalId, calculateKey(goalId));
+}
+
+void DStarLite::plan(const Position start, const Position goal) {
+    startId = graph.toIndex(start.row, start.column);
+    goalId = graph.toIndex(goal.row, goal.column);
+    restart();
+}
+
+bool DStarLite::isPlanning(const Position goal) const {
+    return goalId != -1 && goalId == graph.toIndex(goal.row, goal.column);
+}
+
+void DStarLite::moveStart(const Position start) {
+    startId = graph.toIndex(start.row, start.column);
+}
+
+void DStarLite::cellChanged(const int row, const int col) {
+    if (goalId != -1) {
+        changedCells.push_back(graph.toIndex(row, col));
+    }
+}
+
+/**
+ * @brief Repara el plan con los cambios pendientes y devuelve el camino actual.
+ *
+ * Si el inicio se movió, km crece con la heurística del desplazamiento para que las claves que ya están
+ * en la cola sigan siendo cotas válidas. Cada celda cambiada, y las celdas que el tanque dejó y ocupó,
+ * se reevalúan junto a sus vecinos; después computeShortestPath() solo expande lo que dependía de ellas.
+ * El camino se sigue por el vecino de menor g, que según D* Lite da un camino más corto desde el inicio.
+ */
+Path DStarLite::getPath() {
+    if (goalId == -1) {
+        return {};
+    }
+
+    expandedNodes = 0;
+    if (graphVersion() != syncedVersion + changedCells.size()) {
+        restart();
+    } else if (!changedCells.empty() || startId != lastStartId) {
+        changedCells.push_back(lastStartId);
+        changedCells.push_back(startId);
+        keyModifier += heuristic(lastStartId, startId);
+        lastStartId = startId;
+
+        for (int i = 0; i < changedCells.size(); ++i) {
+            // Una celda que pasó a ser obstáculo no tiene vecinos en su máscara: recorrer los cuatro
+            const int row = changedCells[i] / graph.getCols();
+            const int col = changedCells[i] % graph.getCols();
+            updateVertex(changedCells[i]);
+            for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+                const int neighborRow = row + GridGraph::NEIGHBOR_ROW_OFFSETS[direction];
+                const int neighborCol = col + GridGraph::NEIGHBOR_COL_OFFSETS[direction];
+                if (graph.isValid(neighborRow, neighborCol)) {
+                    updateVertex(graph.toIndex(neighborRow, neighborCol));
+                }
+            }
+        }
+        changedCells.clear();
+        syncedVersion = graphVersion();
+    }
+
+    computeShortestPath();
+
+    const int length = getG(startId);
+    if (length >= INF) {
+        return {};
+    }
+
+    Path path;
+    int current = startId;
+    path.push_back(Position{current / graph.getCols(), current % graph.getCols()});
+    while (current != goalId) {
+        const unsigned char mask = graph.getNeighborMask(current);
+        int next = -1;
+        for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+            if (!(mask & (1 << direction))) {
+                continue;
+            }
+            const int neighbor = graph.getNeighborId(current, direction);
+            if (!isBlocked(neighbor) && (next == -1 || getG(neighbor) < getG(next))) {
+                next = neighbor;
+            }
+        }
+        if (next == -1 || getG(next) >= getG(current) || path.size() > length) {
+            return {};
+        }
+        current = next;
+        path.push_back(Position{current / graph.getCols(), current % graph.getCols()});
+    }
+    return path;
+}
+
+void DStarLite::clear() {
+    goalId = -1;
+    changedCells.clear();
+}
+
+int DStarLite::getExpandedNodeCount() const {
+    return expandedNodes;
+}
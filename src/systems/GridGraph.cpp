@@ -1,13 +1,10 @@
 #include "systems/GridGraph.h"
-#include <cstdlib>
-#include <ctime>
 #include <random>
 #include <algorithm>
-#include "data_structures/LinkedList.h"
+#include <stdexcept>
 #include "data_structures/DynamicArray.h"
-#include "data_structures/Queue.h"
-#include "data_structures/HashSet.h"
 #include "data_structures/Pair.h"
+#include "data_structures/Bitboard.h"
 
 using namespace DATA_STRUCTURES;
 
@@ -16,154 +13,228 @@ using namespace DATA_STRUCTURES;
  *
  * @param id Identificador único del nodo.
  * @param accessible Indica si el nodo es accesible (true por defecto).
+ * @param occupied Indica si el nodo está ocupado (false por defecto).
  */
-Node::Node(int id, bool accessible) : id(id), obstacle(accessible) {}
+Node::Node(int id, bool accessible, bool occupied) : id(id), obstacle(accessible), occupied(occupied) {}
 
 /**
  * @brief Constructor de la clase GridGraph.
  *
- * Inicializa la cuadrícula de nodos con un número predefinido de filas y columnas.
+ * Inicializa la cuadrícula de nodos con las dimensiones indicadas.
  * Los nodos son accesibles por defecto.
+ *
+ * @param rows Número de filas de la cuadrícula.
+ * @param cols Número de columnas de la cuadrícula.
  */
-GridGraph::GridGraph() {
-    // Inicializar la cuadrícula de nodos con filas y columnas predefinidas
-    int id = 0;
-    grid.resize(rows);
-    for (int row = 0; row < rows; ++row) {
-        grid[row].resize(cols);
-        for (int col = 0; col < cols; ++col) {
-            grid[row][col] = Node(id++, true);  // Todos los nodos son accesibles por defecto
-        }
-
+GridGraph::GridGraph(const int rows, const int cols) : rows(rows), cols(cols), rng(std::random_device{}()) {
+    if (rows < MIN_ROWS || cols < MIN_COLS) {
+        throw std::invalid_argument("Dimensiones de la cuadrícula demasiado pequeñas");
     }
 
-    // Inicializar la lista de adyacencia
-    adjList.resize(rows * cols);
-    std::cout << "adjList initialized with size: " << adjList.size() << std::endl;
-    // Inicializar los nodos seguros
-    int safeLeft[] = {75, 76, 100, 101, 102, 125, 126, 127, 150, 151, 152, 175, 176, 177, 200, 201, 202, 225, 226};
-    int safeRight[] = {98, 99, 122, 123, 124, 147, 148, 149, 172, 173, 174, 197, 198, 199, 222, 223, 224, 248, 249};
-    for (int i = 0; i < sizeof(safeLeft) / sizeof(int); ++i) {
-        safeNodeIdsLeft.push_back(safeLeft[i]);
+    // Inicializar los planos de celdas (fila mayor); todos los nodos son accesibles por defecto
+    walkable.resize(rows * cols);
+    occupied.resize(rows * cols);
+    safe.resize(rows * cols);
+    for (int i = 0; i < walkable.size(); ++i) {
+        walkable[i] = 1;
+        occupied[i] = 0;
+        safe[i] = 0;
     }
-    for (int i = 0; i < sizeof(safeRight) / sizeof(int); ++i) {
-        safeNodeIdsRight.push_back(safeRight[i]);
+
+    // Planos de bits equivalentes
+    walkableBits = Bitboard(rows, cols);
+    walkableBits.fill(true);
+    occupiedBits = Bitboard(rows, cols);
+    safeBits = Bitboard(rows, cols);
+
+    // Reservar las máscaras de vecinos
+    neighborMask.resize(rows * cols);
+
+    // Al inicio todas las celdas están libres
+    freeCells.resize(rows * cols);
+    freeSlot.resize(rows * cols);
+    for (int i = 0; i < freeCells.size(); ++i) {
+        freeCells[i] = i;
+        freeSlot[i] = i;
     }
-}
 
-/**
- * @brief Metodo para obtener la lista de adyacencia del grafo.
- * @return Una referencia constante a la lista de adyacencia.
- */
-const DynamicArray<LinkedList<int>>& GridGraph::getAdjList() const {
-    return adjList;
+    // Inicializar los nodos seguros
+    initializeSafeZones();
+
+    // Conectar la cuadrícula inicial; a partir de aquí las máscaras se mantienen de forma incremental
+    connectNodes();
 }
 
 /**
- * @brief Convierte las coordenadas 2D a un índice 1D en la cuadrícula.
+ * @brief Calcula las zonas seguras de ambos extremos a partir de las dimensiones.
  *
- * @param row Fila del nodo.
- * @param col Columna del nodo.
- * @return Índice 1D correspondiente al nodo.
+ * Cada zona está centrada verticalmente, ocupa 7/13 de las filas y 3/25 de las columnas
+ * (con las esquinas recortadas), de modo que en el mapa de 13x25 coincide con la zona original.
  */
-int GridGraph::toIndex(int row, int col) const {
-    return row * cols + col;
+void GridGraph::initializeSafeZones() {
+    const int zoneHeight = std::max(3, rows * 7 / DEFAULT_ROWS);
+    const int zoneDepth = std::min(std::max(2, cols * 3 / DEFAULT_COLS), (cols - 1) / 2);
+    const int top = (rows - zoneHeight) / 2;
+    const int bottom = top + zoneHeight - 1;
+
+    for (int row = top; row <= bottom; ++row) {
+        // La primera y la última fila de la zona son una columna más angostas
+        const int width = row == top || row == bottom ? zoneDepth - 1 : zoneDepth;
+
+        for (int col = 0; col < width; ++col) {
+            const int nodeId = toIndex(row, col);
+            safeNodeIdsLeft.push_back(nodeId);
+            safe[nodeId] = 1;
+            safeBits.set(row, col);
+        }
+        for (int col = cols - width; col < cols; ++col) {
+            const int nodeId = toIndex(row, col);
+            safeNodeIdsRight.push_back(nodeId);
+            safe[nodeId] = 1;
+            safeBits.set(row, col);
+        }
+    }
 }
+
 /**
  * @brief Conecta los nodos accesibles en la cuadrícula.
  *
- * Conecta cada nodo con sus vecinos (arriba, abajo, izquierda, derecha) si son accesibles.
+ * Recorre la cuadrícula una sola vez y escribe, para cada nodo accesible, una máscara de 4 bits
+ * con los vecinos accesibles (arriba, abajo, izquierda, derecha).
  */
 void GridGraph::connectNodes() {
-    std::cout << "adjList size before connecting nodes: " << adjList.size() << std::endl;
-    if (!adjList.empty()) {
-        // Acceder a adjList[currentIndex]
-    } else {
-        std::cerr << "adjList está vacía en connectNodes()" << std::endl;
-    }
-    // Asegurar que adjList tiene el tamaño correcto
-    if (adjList.size() != rows * cols) {
-        adjList.resize(rows * cols);
-    }
-
-    // Limpiar la lista de adyacencia antes de reconstruirla
-    for (int i = 0; i < adjList.size(); ++i) {
-        adjList[i].clear();
-    }
-
     for (int row = 0; row < rows; ++row) {
         for (int col = 0; col < cols; ++col) {
-            Node& currentNode = grid[row][col];
-            if (!currentNode.obstacle) {
-                continue; // Si el nodo no es accesible, no se conecta
-            }
-
-            int currentIndex = toIndex(row, col);
-
-            // Conectar al vecino de arriba
-            if (row > 0 && grid[row - 1][col].obstacle) {
-                int upIndex = toIndex(row - 1, col);
-                adjList[currentIndex].push_back(upIndex);
-            }
-
-            // Conectar al vecino de abajo
-            if (row < rows - 1 && grid[row + 1][col].obstacle) {
-                int downIndex = toIndex(row + 1, col);
-                adjList[currentIndex].push_back(downIndex);
-            }
-
-            // Conectar al vecino de la izquierda
-            if (col > 0 && grid[row][col - 1].obstacle) {
-                int leftIndex = toIndex(row, col - 1);
-                adjList[currentIndex].push_back(leftIndex);
-            }
+            updateNeighborMask(row, col);
+        }
+    }
+}
 
-            // Conectar al vecino de la derecha
-            if (col < cols - 1 && grid[row][col + 1].obstacle) {
-                int rightIndex = toIndex(row, col + 1);
-                adjList[currentIndex].push_back(rightIndex);
+/**
+ * @brief Recalcula la máscara de vecinos de un único nodo.
+ *
+ * @param row Fila del nodo.
+ * @param col Columna del nodo.
+ */
+void GridGraph::updateNeighborMask(const int row, const int col) {
+    const int currentIndex = toIndex(row, col);
+    unsigned char mask = 0;
+
+    // Si el nodo no es accesible, no se conecta
+    const unsigned char* cells = walkable.rawData();
+    if (cells[currentIndex]) {
+        for (int direction = 0; direction < NEIGHBOR_COUNT; ++direction) {
+            const int neighborRow = row + NEIGHBOR_ROW_OFFSETS[direction];
+            const int neighborCol = col + NEIGHBOR_COL_OFFSETS[direction];
+            if (isValid(neighborRow, neighborCol) && cells[toIndex(neighborRow, neighborCol)]) {
+                mask |= 1 << direction;
             }
         }
     }
+
+    neighborMask.rawData()[currentIndex] = mask;
 }
 
 /**
  * @brief Modifica la accesibilidad de un nodo en la cuadrícula.
  *
+ * Solo se recalculan las máscaras del nodo y de sus cuatro vecinos, y se incrementa la versión del mapa.
+ *
  * @param row Fila del nodo.
  * @param col Columna del nodo.
  * @param accessible Valor booleano que indica si el nodo es accesible o no.
  */
 void GridGraph::setNodeAccessibility(int row, int col, bool accessible) {
-    grid[row][col].obstacle = accessible;
+    const int nodeId = toIndex(row, col);
+    if (static_cast<bool>(walkable[nodeId]) == accessible) {
+        return;
+    }
+
+    walkable[nodeId] = accessible;
+    walkableBits.set(row, col, accessible);
+    updateFreeCell(nodeId);
+    updateNeighborMask(row, col);
+    for (int direction = 0; direction < NEIGHBOR_COUNT; ++direction) {
+        const int neighborRow = row + NEIGHBOR_ROW_OFFSETS[direction];
+        const int neighborCol = col + NEIGHBOR_COL_OFFSETS[direction];
+        if (isValid(neighborRow, neighborCol)) {
+            updateNeighborMask(neighborRow, neighborCol);
+        }
+    }
+
+    ++mapVersion;
 }
 
-bool GridGraph::isObstacle(int row, int col) const {
-    return !grid[row][col].obstacle;
+/**
+ * @brief Devuelve la versión del mapa.
+ *
+ * @return Contador que aumenta con cada cambio de accesibilidad.
+ */
+unsigned long GridGraph::getMapVersion() const {
+    return mapVersion;
 }
 
-bool GridGraph::isOccupied(int row, int col) const {
-    return grid[row][col].occupied;
+unsigned long GridGraph::getOccupancyVersion() const {
+    return occupancyVersion;
 }
 
 void GridGraph::placeTank(const int row, const int col) {
-    grid[row][col].occupied = true;
+    const int nodeId = toIndex(row, col);
+    if (occupied[nodeId]) {
+        return;
+    }
+    occupied[nodeId] = true;
+    occupiedBits.set(row, col);
+    updateFreeCell(nodeId);
+    ++occupancyVersion;
 }
 
 void GridGraph::removeTank(int row, int col) {
-    grid[row][col].occupied = false;
+    const int nodeId = toIndex(row, col);
+    if (!occupied[nodeId]) {
+        return;
+    }
+    occupied[nodeId] = false;
+    occupiedBits.set(row, col, false);
+    updateFreeCell(nodeId);
+    ++occupancyVersion;
+}
+
+/**
+ * @brief Sincroniza el índice de celdas libres con el estado de un nodo.
+ *
+ * Una celda es libre si es accesible y no está ocupada. Las altas se añaden al final y las bajas
+ * se eliminan intercambiándolas con la última entrada, ambas en O(1).
+ *
+ * @param id ID del nodo.
+ */
+void GridGraph::updateFreeCell(const int id) {
+    const bool isFree = walkable[id] && !occupied[id];
+    const int slot = freeSlot[id];
+
+    if (isFree && slot == -1) {
+        freeSlot[id] = freeCells.size();
+        freeCells.push_back(id);
+    } else if (!isFree && slot != -1) {
+        const int lastId = freeCells.back();
+        freeCells[slot] = lastId;
+        freeSlot[lastId] = slot;
+        freeCells.pop_back();
+        freeSlot[id] = -1;
+    }
 }
 
 /**
  * @brief Imprime la representación del grafo, mostrando las conexiones entre nodos.
  */
 void GridGraph::printGraph() const {
-    for (int i = 0; i < adjList.size(); ++i) {
+    for (int i = 0; i < neighborMask.size(); ++i) {
         std::cout << "Node " << i << " is connected to: ";
-        const LinkedList<int>& neighbors = adjList[i];
-        for (int j = 0; j < neighbors.size(); ++j) {
-            int neighbor = neighbors[j];
-            std::cout << neighbor << " ";
+        const unsigned char mask = neighborMask[i];
+        for (int direction = 0; direction < NEIGHBOR_COUNT; ++direction) {
+            if (mask & (1 << direction)) {
+                std::cout << getNeighborId(i, direction) << " ";
+            }
         }
         std::cout << std::endl;
     }
@@ -177,39 +248,36 @@ void GridGraph::printGraph() const {
 void GridGraph::printAccessibility() const {
     for (int row = 0; row < rows; ++row) {
         for (int col = 0; col < cols; ++col) {
-            std::cout << (grid[row][col].obstacle ? "1 " : "0 ");
+            std::cout << (walkable[toIndex(row, col)] ? "1 " : "0 ");
         }
         std::cout << std::endl;
     }
 }
 
 /**
- * @brief Devuelve el número de filas de la cuadrícula.
+ * @brief Devuelve una copia de un nodo específico en la cuadrícula.
+ *
+ * El ID se calcula a partir del índice y los estados se leen de los planos de celdas.
  *
- * @return Número de filas.
+ * @param row Fila del nodo.
+ * @param col Columna del nodo.
+ * @return Nodo construido a partir de los planos de celdas.
  */
-int GridGraph::getRows() const {
-    return rows;
+Node GridGraph::getNode(int row, int col) const {
+    const int id = toIndex(row, col);
+    return Node(id, walkable.rawData()[id], occupied.rawData()[id]);
 }
 
-/**
- * @brief Devuelve el número de columnas de la cuadrícula.
- *
- * @return Número de columnas.
- */
-int GridGraph::getCols() const {
-    return cols;
+const Bitboard& GridGraph::getWalkableBoard() const {
+    return walkableBits;
 }
 
-/**
- * @brief Devuelve una referencia constante a un nodo específico en la cuadrícula.
- *
- * @param row Fila del nodo.
- * @param col Columna del nodo.
- * @return Referencia constante al nodo.
- */
-const Node& GridGraph::getNode(int row, int col) const {
-    return grid[row][col];
+const Bitboard& GridGraph::getOccupiedBoard() const {
+    return occupiedBits;
+}
+
+const Bitboard& GridGraph::getSafeBoard() const {
+    return safeBits;
 }
 
 /**
@@ -221,24 +289,8 @@ const Node& GridGraph::getNode(int row, int col) const {
  * @return true Si el nodo es seguro.
  * @return false Si el nodo no es seguro.
  */
-bool GridGraph::isSafeNode(int nodeId) const{
-
-    for (int i = 0; i < safeNodeIdsRight.size(); ++i) {
-        int safeNode = safeNodeIdsRight[i];
-        if (safeNode == nodeId) {
-            return true;
-        }
-    }
-
-    for (int i = 0; i < safeNodeIdsLeft.size(); ++i) {
-        int safeNode = safeNodeIdsLeft[i];
-        if (safeNode == nodeId) {
-            return true;
-        }
-    }
-
-
-    return false;
+bool GridGraph::isSafeNode(int nodeId) const {
+    return safe.rawData()[nodeId];
 }
 
 struct ObstacleShape {
@@ -258,72 +310,134 @@ static const std::vector<ObstacleShape> predefinedShapes = {
     { { {0, -1}, {0, 0}, {0, 1}, {1, 0} } }
 };
 
+/**
+ * @brief Huella de una forma como máscaras de bits por fila, para comprobar su encaje con palabras completas.
+ */
+struct ShapeFootprint {
+    int minRow, maxRow, minCol, maxCol; // Extensión de la forma respecto a la celda base
+    std::vector<Bitboard::Word> rowMasks; // Máscara de la fila minRow + i, con el bit 0 en la columna minCol
+};
+
+/**
+ * @brief Calcula la huella de bits de cada forma predefinida.
+ *
+ * @return Huellas en el mismo orden que predefinedShapes.
+ */
+static std::vector<ShapeFootprint> buildShapeFootprints() {
+    std::vector<ShapeFootprint> footprints;
+    for (const auto& shape : predefinedShapes) {
+        ShapeFootprint footprint{shape.cells[0].first, shape.cells[0].first,
+                                 shape.cells[0].second, shape.cells[0].second, {}};
+        for (const auto& cell : shape.cells) {
+            footprint.minRow = std::min(footprint.minRow, cell.first);
+            footprint.maxRow = std::max(footprint.maxRow, cell.first);
+            footprint.minCol = std::min(footprint.minCol, cell.second);
+            footprint.maxCol = std::max(footprint.maxCol, cell.second);
+        }
+        footprint.rowMasks.assign(footprint.maxRow - footprint.minRow + 1, 0);
+        for (const auto& cell : shape.cells) {
+            footprint.rowMasks[cell.first - footprint.minRow] |= Bitboard::Word(1) << (cell.second - footprint.minCol);
+        }
+        footprints.push_back(footprint);
+    }
+    return footprints;
+}
+
+static const std::vector<ShapeFootprint> shapeFootprints = buildShapeFootprints();
 
-Position GridGraph::getRandomAccessiblePosition() const {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> rowDis(0, rows - 1);
-    std::uniform_int_distribution<> colDis(0, cols - 1);
 
-    auto randomPosition = Position(rowDis(gen), colDis(gen));
-    while (isObstacle(randomPosition.row, randomPosition.column)
-        || isOccupied(randomPosition.row, randomPosition.column)) {
-        randomPosition.row = rowDis(gen);
-        randomPosition.column = colDis(gen);
+/**
+ * @brief Obtiene una posición accesible y libre aleatoria en O(1) a partir del índice de celdas libres.
+ *
+ * @return Objeto Position con la fila y columna de la posición.
+ * @throws std::runtime_error Si no queda ninguna celda libre.
+ */
+Position GridGraph::getRandomAccessiblePosition() const {
+    if (freeCells.empty()) {
+        throw std::runtime_error("No hay celdas libres en la cuadrícula");
     }
 
-    return randomPosition;
+    std::uniform_int_distribution<> slotDis(0, freeCells.size() - 1);
+    const int nodeId = freeCells[slotDis(rng)];
+    return Position(nodeId / cols, nodeId % cols);
+}
+
+/**
+ * @brief Devuelve el número de celdas accesibles y no ocupadas.
+ *
+ * @return Número de celdas libres.
+ */
+int GridGraph::getFreeCellCount() const {
+    return freeCells.size();
 }
 
 
+/**
+ * @brief Devuelve un entero aleatorio en [0, bound) usando el generador de la instancia.
+ *
+ * @param bound Límite superior exclusivo (mayor que 0).
+ * @return Entero aleatorio.
+ */
+int GridGraph::randomInt(const int bound) const {
+    std::uniform_int_distribution<> dis(0, bound - 1);
+    return dis(rng);
+}
+
+/**
+ * @brief Genera obstáculos con una semilla no determinista.
+ */
 void GridGraph::generateObstacles() {
-    // Inicializar random seed
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    generateObstacles(std::random_device{}());
+}
+
+/**
+ * @brief Genera obstáculos de forma reproducible a partir de una semilla.
+ *
+ * Todo el azar proviene del generador de la instancia, por lo que la misma semilla y dimensiones producen
+ * siempre el mismo mapa y varias instancias pueden generarse a la vez en hilos distintos.
+ *
+ * @param seed Semilla del generador.
+ */
+void GridGraph::generateObstacles(const unsigned int seed) {
+    rng.seed(seed);
     std::uniform_int_distribution<> shapeDis(0, predefinedShapes.size() - 1);
     std::uniform_int_distribution<> rowDis(0, rows - 1);
     std::uniform_int_distribution<> colDis(0, cols - 1);
 
-    // Número de obstáculos a generar
-    int numObstacles = 10 + std::rand() % 10;
+    // Número de obstáculos a generar, proporcional al área respecto al mapa predeterminado
+    const int scale = std::max(1, rows * cols / (DEFAULT_ROWS * DEFAULT_COLS));
+    int numObstacles = (10 + randomInt(10)) * scale;
 
     int attempts = 0;
-    int maxAttempts = 1000; // Para evitar bucles infinitos
+    int maxAttempts = 1000 * scale; // Para evitar bucles infinitos
     int placedObstacles = 0;
 
     while (placedObstacles < numObstacles && attempts < maxAttempts) {
         attempts++;
 
         // Seleccionar una forma aleatoria
-        const ObstacleShape& shape = predefinedShapes[shapeDis(gen)];
+        const int shapeIndex = shapeDis(rng);
+        const ObstacleShape& shape = predefinedShapes[shapeIndex];
+        const ShapeFootprint& footprint = shapeFootprints[shapeIndex];
 
         // Seleccionar una posición inicial aleatoria
-        int baseRow = rowDis(gen);
-        int baseCol = colDis(gen);
-
-        // Verificar si la forma cabe en la posición y no interfiere con nodos seguros
-        bool canPlace = true;
-        std::vector<Pair<int, int>> absolutePositions;
-
-        for (const auto& cell : shape.cells) {
-            int row = baseRow + cell.first;
-            int col = baseCol + cell.second;
-
-            // Verificar límites
-            if (row < 0 || row >= rows || col < 0 || col >= cols) {
-                canPlace = false;
-                break;
-            }
+        int baseRow = rowDis(rng);
+        int baseCol = colDis(rng);
 
-            int nodeId = toIndex(row, col);
+        // Verificar límites
+        if (baseRow + footprint.minRow < 0 || baseRow + footprint.maxRow >= rows
+            || baseCol + footprint.minCol < 0 || baseCol + footprint.maxCol >= cols) {
+            continue;
+        }
 
-            // Verificar si es un nodo seguro
-            if (isSafeNode(nodeId)) {
+        // Verificar, una fila de la forma por palabra, que no interfiere con nodos seguros
+        bool canPlace = true;
+        const int shapeRows = static_cast<int>(footprint.rowMasks.size());
+        for (int i = 0; i < shapeRows; ++i) {
+            if (safeBits.intersects(baseRow + footprint.minRow + i, baseCol + footprint.minCol, footprint.rowMasks[i])) {
                 canPlace = false;
                 break;
             }
-
-            absolutePositions.emplace_back(row, col);
         }
 
         if (!canPlace) {
@@ -331,8 +445,8 @@ void GridGraph::generateObstacles() {
         }
 
         // Colocar la forma en la cuadrícula
-        for (const auto& pos : absolutePositions) {
-            grid[pos.first][pos.second].obstacle = false; // Hacer inaccesible
+        for (const auto& cell : shape.cells) {
+            setNodeAccessibility(baseRow + cell.first, baseCol + cell.second, false); // Hacer inaccesible
         }
 
         placedObstacles++;
@@ -352,80 +466,35 @@ void GridGraph::generateObstacles() {
     // Verificar que no se han creado áreas inaccesibles
     ensureNoIsolatedAreas();
 
-    // Reconectar los nodos después de modificar la cuadrícula
-    connectNodes();
-}
-
-/**
- * @brief Devuelve una referencia constante al nodo dado su ID.
- *
- * @param id Identificador único del nodo.
- * @return Referencia constante al nodo.
- */
-const Node& GridGraph::getNodeById(int id) const {
-    int row = id / cols;
-    int col = id % cols;
-    return grid[row][col];
 }
 
 /**
- * @brief Devuelve una referencia al nodo dado su ID.
+ * @brief Devuelve una copia del nodo dado su ID.
  *
  * @param id Identificador único del nodo.
- * @return Referencia al nodo.
+ * @return Nodo construido a partir de los planos de celdas.
  */
-Node& GridGraph::getNodeById(int id) {
-    int row = id / cols;
-    int col = id % cols;
-    return grid[row][col];
+Node GridGraph::getNodeById(int id) const {
+    return Node(id, walkable.rawData()[id], occupied.rawData()[id]);
 }
 
 void GridGraph::ensureSafeNodesConnectivity() {
-    // Realizar BFS desde los nodos seguros de la izquierda
-    Queue<int> q;
-    HashSet<int> visited;
+    // Etiquetar las componentes y marcar las que contienen nodos seguros de la izquierda
+    labelComponents();
 
-    // Agregar todos los nodos seguros de la izquierda al inicio del BFS
+    DynamicArray<unsigned char> leftComponents(componentCount);
     for (int i = 0; i < safeNodeIdsLeft.size(); ++i) {
-        int nodeId = safeNodeIdsLeft[i];
-        q.push(nodeId);
-        visited.insert(nodeId);
+        const int component = componentId[safeNodeIdsLeft[i]];
+        if (component != -1) {
+            leftComponents[component] = 1;
+        }
     }
 
+    // Si algún nodo seguro de la derecha comparte componente, entonces están conectados
     bool connected = false;
-
-    while (!q.empty()) {
-        int currentId = q.front();
-        q.pop();
-
-        // Si hemos llegado a un nodo seguro de la derecha, entonces están conectados
-        for (int i = 0; i < safeNodeIdsRight.size(); ++i) {
-            if (currentId == safeNodeIdsRight[i]) {
-                connected = true;
-                break;
-            }
-        }
-        if (connected) {
-            break;
-        }
-
-        int row = currentId / cols;
-        int col = currentId % cols;
-
-        // Vecinos (arriba, abajo, izquierda, derecha)
-        LinkedList<int> neighbors;
-        if (row > 0 && grid[row - 1][col].obstacle) neighbors.push_back(toIndex(row - 1, col));
-        if (row < rows - 1 && grid[row + 1][col].obstacle) neighbors.push_back(toIndex(row + 1, col));
-        if (col > 0 && grid[row][col - 1].obstacle) neighbors.push_back(toIndex(row, col - 1));
-        if (col < cols - 1 && grid[row][col + 1].obstacle) neighbors.push_back(toIndex(row, col + 1));
-
-        for (int i = 0; i < neighbors.size(); ++i) {
-            int neighborId = neighbors[i];
-            if (!visited.contains(neighborId)) {
-                visited.insert(neighborId);
-                q.push(neighborId);
-            }
-        }
+    for (int i = 0; i < safeNodeIdsRight.size() && !connected; ++i) {
+        const int component = componentId[safeNodeIdsRight[i]];
+        connected = component != -1 && leftComponents[component];
     }
 
     if (!connected) {
@@ -452,7 +521,7 @@ void GridGraph::ensureSafeNodesConnectivity() {
             // Verificar que no sea un nodo seguro antes de modificar
             int nodeId = toIndex(currentRow, currentCol);
             if (!isSafeNode(nodeId)) {
-                grid[currentRow][currentCol].obstacle = true; // Hacer accesible
+                setNodeAccessibility(currentRow, currentCol, true); // Hacer accesible
             }
         }
     }
@@ -460,51 +529,29 @@ void GridGraph::ensureSafeNodesConnectivity() {
 
 
 void GridGraph::ensureNoIsolatedAreas() {
-    // Realizar BFS desde los nodos seguros para marcar nodos alcanzables
-    Queue<int> q;
-    HashSet<int> visited;
+    // Etiquetar las componentes y conservar las que contienen nodos seguros
+    labelComponents();
 
-    // Agregar todos los nodos seguros al inicio del BFS
+    DynamicArray<unsigned char> reachable(componentCount);
     for (int i = 0; i < safeNodeIdsLeft.size(); ++i) {
-        int nodeId = safeNodeIdsLeft[i];
-        q.push(nodeId);
-        visited.insert(nodeId);
+        const int component = componentId[safeNodeIdsLeft[i]];
+        if (component != -1) {
+            reachable[component] = 1;
+        }
     }
     for (int i = 0; i < safeNodeIdsRight.size(); ++i) {
-        int nodeId = safeNodeIdsRight[i];
-        q.push(nodeId);
-        visited.insert(nodeId);
-    }
-
-    while (!q.empty()) {
-        int currentId = q.front();
-        q.pop();
-
-        int row = currentId / cols;
-        int col = currentId % cols;
-
-        // Vecinos (arriba, abajo, izquierda, derecha)
-        LinkedList<int> neighbors;
-        if (row > 0 && grid[row - 1][col].obstacle) neighbors.push_back(toIndex(row - 1, col));
-        if (row < rows - 1 && grid[row + 1][col].obstacle) neighbors.push_back(toIndex(row + 1, col));
-        if (col > 0 && grid[row][col - 1].obstacle) neighbors.push_back(toIndex(row, col - 1));
-        if (col < cols - 1 && grid[row][col + 1].obstacle) neighbors.push_back(toIndex(row, col + 1));
-
-        for (int i = 0; i < neighbors.size(); ++i) {
-            int neighborId = neighbors[i];
-            if (!visited.contains(neighborId)) {
-                visited.insert(neighborId);
-                q.push(neighborId);
-            }
+        const int component = componentId[safeNodeIdsRight[i]];
+        if (component != -1) {
+            reachable[component] = 1;
         }
     }
 
-    // Convertir en obstáculos los nodos accesibles no visitados
+    // Convertir en obstáculos los nodos accesibles de componentes sin nodos seguros
     for (int row = 0; row < rows; ++row) {
         for (int col = 0; col < cols; ++col) {
             int nodeId = toIndex(row, col);
-            if (grid[row][col].obstacle && !visited.contains(nodeId)) {
-                grid[row][col].obstacle = false; // Hacer inaccesible
+            if (walkable[nodeId] && !reachable[componentId[nodeId]]) {
+                setNodeAccessibility(row, col, false); // Hacer inaccesible
             }
         }
     }
@@ -516,7 +563,7 @@ void GridGraph::ensureObstacleBetweenLeftAndRight() {
 
     for (int row = 0; row < rows; ++row) {
         for (int col = 1; col < cols - 1; ++col) {
-            if (!grid[row][col].obstacle) {
+            if (!walkable[toIndex(row, col)]) {
                 obstacleFound = true;
                 break;
             }
@@ -525,90 +572,253 @@ void GridGraph::ensureObstacleBetweenLeftAndRight() {
     }
 
     if (!obstacleFound) {
-        // Intentar colocar un obstáculo sin bloquear la conectividad
-        int attempts = 0;
-        const int maxAttempts = 1000;
-        while (attempts < maxAttempts) {
-            int randomRow = std::rand() % rows;
-            int randomCol = 1 + std::rand() % (cols - 2); // Evitar las columnas de los extremos
-
-            int nodeId = toIndex(randomRow, randomCol);
-            if (!isSafeNode(nodeId)) {
-                // Verificar si al colocar el obstáculo se mantiene la conectividad
-                bool connectivityMaintained = true;
+        // Elegir directamente entre las celdas que pueden bloquearse sin romper la conectividad
+        analyzeChokepoints();
 
-                // Temporariamente colocar el obstáculo
-                grid[randomRow][randomCol].obstacle = false;
-                connectNodes();
+        DynamicArray<int> candidates;
+        for (int row = 0; row < rows; ++row) {
+            for (int col = 1; col < cols - 1; ++col) { // Evitar las columnas de los extremos
+                const int nodeId = toIndex(row, col);
+                if (walkable[nodeId] && !isSafeNode(nodeId) && !articulation[nodeId]) {
+                    candidates.push_back(nodeId);
+                }
+            }
+        }
+
+        if (!candidates.empty()) {
+            const int nodeId = candidates[randomInt(candidates.size())];
+            setNodeAccessibility(nodeId / cols, nodeId % cols, false);
+        }
+    }
+}
+
+/**
+ * @brief Calcula los puntos de articulación y los puentes del grafo de nodos accesibles.
+ *
+ * Recorrido de Tarjan iterativo en O(V + E); el resultado queda en caché hasta que cambie la versión del mapa.
+ */
+void GridGraph::analyzeChokepoints() const {
+    if (chokepointsValid && chokepointVersion == mapVersion) {
+        return;
+    }
+
+    const int nodeCount = rows * cols;
+    articulation.resize(nodeCount);
+    bridges.clear();
+
+    DynamicArray<int> discovery(nodeCount);
+    DynamicArray<int> low(nodeCount);
+    DynamicArray<int> parent(nodeCount);
+    DynamicArray<unsigned char> nextDirection(nodeCount);
+    for (int i = 0; i < nodeCount; ++i) {
+        articulation[i] = 0;
+        discovery[i] = -1;
+    }
 
-                // Verificar la conectividad
-                if (!isConnected(safeNodeIdsLeft[0], safeNodeIdsRight[0])) {
-                    connectivityMaintained = false;
+    DynamicArray<int> stack;
+    int time = 0;
+
+    for (int root = 0; root < nodeCount; ++root) {
+        if (!walkable[root] || discovery[root] != -1) {
+            continue;
+        }
+
+        int rootChildren = 0;
+        discovery[root] = low[root] = time++;
+        parent[root] = -1;
+        nextDirection[root] = 0;
+        stack.push_back(root);
+
+        while (!stack.empty()) {
+            const int current = stack.back();
+
+            if (nextDirection[current] < NEIGHBOR_COUNT) {
+                const int direction = nextDirection[current]++;
+                if (!(neighborMask[current] & (1 << direction))) {
+                    continue;
                 }
 
-                // Restaurar el estado original si la conectividad se rompe
-                if (!connectivityMaintained) {
-                    grid[randomRow][randomCol].obstacle = true;
-                } else {
-                    // Obstáculo colocado sin romper la conectividad
-                    break;
+                const int neighbor = getNeighborId(current, direction);
+                if (discovery[neighbor] == -1) {
+                    // Arista de árbol: descender al vecino
+                    parent[neighbor] = current;
+                    discovery[neighbor] = low[neighbor] = time++;
+                    nextDirection[neighbor] = 0;
+                    stack.push_back(neighbor);
+                    if (current == root) {
+                        rootChildren++;
+                    }
+                } else if (neighbor != parent[current]) {
+                    // Arista de retroceso
+                    low[current] = std::min(low[current], discovery[neighbor]);
                 }
+                continue;
             }
-            attempts++;
+
+            // Todos los vecinos procesados: propagar low al padre
+            stack.pop_back();
+            const int currentParent = parent[current];
+            if (currentParent == -1) {
+                continue;
+            }
+
+            low[currentParent] = std::min(low[currentParent], low[current]);
+            if (parent[currentParent] != -1 && low[current] >= discovery[currentParent]) {
+                articulation[currentParent] = 1;
+            }
+            if (low[current] > discovery[currentParent]) {
+                bridges.push_back(Pair<int, int>(currentParent, current));
+            }
+        }
+
+        // La raíz es punto de articulación solo si tiene más de un hijo en el árbol
+        if (rootChildren > 1) {
+            articulation[root] = 1;
+        }
+    }
+
+    chokepointVersion = mapVersion;
+    chokepointsValid = true;
+}
+
+/**
+ * @brief Verifica si un nodo es un cuello de botella (punto de articulación).
+ *
+ * @param row Fila del nodo.
+ * @param col Columna del nodo.
+ * @return true Si bloquear el nodo desconecta parte del mapa.
+ */
+bool GridGraph::isChokepoint(const int row, const int col) const {
+    analyzeChokepoints();
+    return articulation[toIndex(row, col)];
+}
+
+/**
+ * @brief Devuelve los IDs de todos los puntos de articulación del mapa.
+ *
+ * @return Arreglo con los IDs en orden de fila mayor.
+ */
+DynamicArray<int> GridGraph::getChokepoints() const {
+    analyzeChokepoints();
+
+    DynamicArray<int> chokepoints;
+    for (int i = 0; i < articulation.size(); ++i) {
+        if (articulation[i]) {
+            chokepoints.push_back(i);
         }
     }
+    return chokepoints;
+}
+
+/**
+ * @brief Devuelve los puentes del grafo de nodos accesibles.
+ *
+ * @return Referencia constante a los pares (ID, ID) de cada puente.
+ */
+const DynamicArray<Pair<int, int>>& GridGraph::getBridges() const {
+    analyzeChokepoints();
+    return bridges;
 }
 
 bool GridGraph::isConnected(int startId, int goalId) {
-    Queue<int> q;
-    HashSet<int> visited;
+    return startId == goalId || areConnected(startId, goalId);
+}
 
-    q.push(startId);
-    visited.insert(startId);
+/**
+ * @brief Etiqueta las componentes conexas de nodos accesibles si la caché está desactualizada.
+ *
+ * Recorre la cuadrícula una sola vez; cada nodo accesible sin etiqueta inicia un relleno por inundación
+ * con una pila explícita que asigna el mismo ID a toda su componente. Los obstáculos quedan con -1.
+ */
+void GridGraph::labelComponents() const {
+    if (componentsValid && componentVersion == mapVersion) {
+        return;
+    }
 
-    while (!q.empty()) {
-        int currentId = q.front();
-        q.pop();
+    const int nodeCount = rows * cols;
+    componentId.resize(nodeCount);
+    for (int i = 0; i < nodeCount; ++i) {
+        componentId[i] = -1;
+    }
+    componentCount = 0;
 
-        if (currentId == goalId) {
-            return true;
+    DynamicArray<int> stack;
+    for (int start = 0; start < nodeCount; ++start) {
+        if (!walkable[start] || componentId[start] != -1) {
+            continue;
         }
 
-        const LinkedList<int>& neighbors = adjList[currentId];
+        const int label = componentCount++;
+        componentId[start] = label;
+        stack.push_back(start);
 
-        for (int i = 0; i < neighbors.size(); ++i) {
-            int neighborId = neighbors[i];
-            if (!visited.contains(neighborId)) {
-                visited.insert(neighborId);
-                q.push(neighborId);
+        while (!stack.empty()) {
+            const int current = stack.back();
+            stack.pop_back();
+
+            const unsigned char mask = neighborMask[current];
+            for (int direction = 0; direction < NEIGHBOR_COUNT; ++direction) {
+                if (!(mask & (1 << direction))) {
+                    continue;
+                }
+                const int neighborId = getNeighborId(current, direction);
+                if (componentId[neighborId] == -1) {
+                    componentId[neighborId] = label;
+                    stack.push_back(neighborId);
+                }
             }
         }
     }
 
-    return false;
+    componentVersion = mapVersion;
+    componentsValid = true;
 }
 
+/**
+ * @brief Verifica en O(1) si dos nodos son mutuamente alcanzables.
+ *
+ * @param firstId ID del primer nodo.
+ * @param secondId ID del segundo nodo.
+ * @return true Si ambos nodos son accesibles y pertenecen a la misma componente.
+ */
+bool GridGraph::areConnected(const int firstId, const int secondId) const {
+    labelComponents();
+    return componentId[firstId] != -1 && componentId[firstId] == componentId[secondId];
+}
 
+/**
+ * @brief Devuelve la componente conexa de un nodo.
+ *
+ * @param id ID del nodo.
+ * @return ID de la componente, o -1 si el nodo es un obstáculo.
+ */
+int GridGraph::getComponentId(const int id) const {
+    labelComponents();
+    return componentId[id];
+}
+
+/**
+ * @brief Devuelve el número de componentes conexas de nodos accesibles.
+ *
+ * @return Número de componentes.
+ */
+int GridGraph::getComponentCount() const {
+    labelComponents();
+    return componentCount;
+}
 
 void GridGraph::ensureObstaclesInLines() {
-    // Asegurar que cada fila tenga al menos un obstáculo
+    // Asegurar que cada fila tenga al menos un obstáculo (una fila sin obstáculos tiene todos sus bits activos)
     for (int row = 0; row < rows; ++row) {
-        bool hasObstacle = false;
-        for (int col = 0; col < cols; ++col) {
-            if (!grid[row][col].obstacle) {
-                hasObstacle = true;
-                break;
-            }
-        }
-        if (!hasObstacle) {
+        if (walkableBits.rowPopcount(row) == cols) {
             // Agregar un obstáculo en una posición aleatoria de la fila, evitando zonas seguras
             int attempts = 0;
             const int maxAttempts = cols;
             while (attempts < maxAttempts) {
-                int col = std::rand() % cols;
+                int col = randomInt(cols);
                 int nodeId = toIndex(row, col);
                 if (!isSafeNode(nodeId)) {
-                    grid[row][col].obstacle = false;
+                    setNodeAccessibility(row, col, false);
                     break;
                 }
                 attempts++;
@@ -616,24 +826,20 @@ void GridGraph::ensureObstaclesInLines() {
         }
     }
 
-    // Asegurar que cada columna tenga al menos un obstáculo
+    // Asegurar que cada columna tenga al menos un obstáculo: la conjunción de todas las filas
+    // deja activas exactamente las columnas sin obstáculos
+    DynamicArray<Bitboard::Word> openColumns;
+    walkableBits.andRows(openColumns);
     for (int col = 0; col < cols; ++col) {
-        bool hasObstacle = false;
-        for (int row = 0; row < rows; ++row) {
-            if (!grid[row][col].obstacle) {
-                hasObstacle = true;
-                break;
-            }
-        }
-        if (!hasObstacle) {
+        if ((openColumns[col / Bitboard::WORD_BITS] >> (col % Bitboard::WORD_BITS)) & 1) {
             // Agregar un obstáculo en una posición aleatoria de la columna, evitando zonas seguras
             int attempts = 0;
             const int maxAttempts = rows;
             while (attempts < maxAttempts) {
-                int row = std::rand() % rows;
+                int row = randomInt(rows);
                 int nodeId = toIndex(row, col);
                 if (!isSafeNode(nodeId)) {
-                    grid[row][col].obstacle = false;
+                    setNodeAccessibility(row, col, false);
                     break;
                 }
                 attempts++;
@@ -642,44 +848,124 @@ void GridGraph::ensureObstaclesInLines() {
     }
 }
 
-void GridGraph::fillLargeOpenAreas() {
-    const int areaSize = 4; // Puedes ajustar este valor a 4 o 5 según tus necesidades
+/**
+ * @brief Rellena áreas abiertas grandes con obstáculos para evitar espacios vacíos.
+ *
+ * Recorre las ventanas de areaSize x areaSize en orden de fila mayor manteniendo, para la franja de filas
+ * actual, el número de obstáculos por columna. Así el vacío de cada ventana se consulta en O(1) y los
+ * obstáculos colocados dentro de ventanas anteriores se contabilizan de inmediato. El costo total es
+ * lineal en el número de celdas.
+ *
+ * @param areaSize Lado de la ventana cuadrada a revisar.
+ */
+void GridGraph::fillLargeOpenAreas(const int areaSize) {
+    if (areaSize <= 0 || areaSize > rows || areaSize > cols) {
+        return;
+    }
+
+    // Obstáculos y nodos seguros por columna dentro de la franja [row, row + areaSize)
+    DynamicArray<int> columnCounts(cols);
+    DynamicArray<int> safeColumnCounts(cols);
+    for (int col = 0; col < cols; ++col) {
+        columnCounts[col] = countObstacles(0, col, areaSize, 1);
+        for (int i = 0; i < areaSize; ++i) {
+            safeColumnCounts[col] += safe[toIndex(i, col)];
+        }
+    }
 
     for (int row = 0; row <= rows - areaSize; ++row) {
+        if (row > 0) {
+            // Desplazar la franja una fila hacia abajo
+            for (int col = 0; col < cols; ++col) {
+                const int entering = toIndex(row + areaSize - 1, col);
+                const int leaving = toIndex(row - 1, col);
+                columnCounts[col] += !walkable[entering] - !walkable[leaving];
+                safeColumnCounts[col] += safe[entering] - safe[leaving];
+            }
+        }
+
+        int windowCount = 0;
+        int safeWindowCount = 0;
+        for (int col = 0; col < areaSize; ++col) {
+            windowCount += columnCounts[col];
+            safeWindowCount += safeColumnCounts[col];
+        }
+
         for (int col = 0; col <= cols - areaSize; ++col) {
-            bool isOpenArea = true;
+            if (col > 0) {
+                windowCount += columnCounts[col + areaSize - 1] - columnCounts[col - 1];
+                safeWindowCount += safeColumnCounts[col + areaSize - 1] - safeColumnCounts[col - 1];
+            }
 
             // Verificar si el área de areaSize x areaSize está libre de obstáculos
-            for (int i = 0; i < areaSize; ++i) {
-                for (int j = 0; j < areaSize; ++j) {
-                    if (!grid[row + i][col + j].obstacle) {
-                        isOpenArea = false;
-                        break;
-                    }
-                }
-                if (!isOpenArea) break;
+            // (un área formada solo por nodos seguros no admite obstáculos)
+            if (windowCount != 0 || safeWindowCount == areaSize * areaSize) {
+                continue;
             }
 
-            if (isOpenArea) {
-                // Colocar obstáculos en posiciones aleatorias dentro del área
-                int obstaclesToPlace = areaSize; // Número de obstáculos a colocar
-                int attempts = 0;
-                const int maxAttempts = areaSize * areaSize * 2;
-                while (obstaclesToPlace > 0 && attempts < maxAttempts) {
-                    int i = std::rand() % areaSize;
-                    int j = std::rand() % areaSize;
-                    int nodeId = toIndex(row + i, col + j);
-                    if (grid[row + i][col + j].obstacle && !isSafeNode(nodeId)) {
-                        grid[row + i][col + j].obstacle = false;
-                        obstaclesToPlace--;
-                    }
-                    attempts++;
+            // Colocar obstáculos en posiciones aleatorias dentro del área
+            int obstaclesToPlace = areaSize; // Número de obstáculos a colocar
+            int attempts = 0;
+            const int maxAttempts = areaSize * areaSize * 2;
+            while (obstaclesToPlace > 0 && attempts < maxAttempts) {
+                int i = randomInt(areaSize);
+                int j = randomInt(areaSize);
+                int nodeId = toIndex(row + i, col + j);
+                if (walkable[nodeId] && !isSafeNode(nodeId)) {
+                    setNodeAccessibility(row + i, col + j, false);
+                    columnCounts[col + j]++;
+                    windowCount++;
+                    obstaclesToPlace--;
                 }
+                attempts++;
             }
         }
     }
 }
 
-bool GridGraph::isValid(const int row, const int column) {
-    return row >= 0 && row < rows && column >= 0 && column < cols;
+/**
+ * @brief Reconstruye la tabla de sumas acumuladas (imagen integral) del plano de obstáculos si está desactualizada.
+ */
+void GridGraph::updateObstacleSums() const {
+    if (obstacleSumsValid && obstacleSumsVersion == mapVersion) {
+        return;
+    }
+
+    const int width = cols + 1;
+    obstacleSums.resize((rows + 1) * width);
+    for (int col = 0; col < width; ++col) {
+        obstacleSums[col] = 0;
+    }
+
+    for (int row = 0; row < rows; ++row) {
+        obstacleSums[(row + 1) * width] = 0;
+        for (int col = 0; col < cols; ++col) {
+            obstacleSums[(row + 1) * width + col + 1] = !walkable[toIndex(row, col)]
+                + obstacleSums[row * width + col + 1]
+                + obstacleSums[(row + 1) * width + col]
+                - obstacleSums[row * width + col];
+        }
+    }
+
+    obstacleSumsVersion = mapVersion;
+    obstacleSumsValid = true;
+}
+
+/**
+ * @brief Cuenta los obstáculos dentro de un rectángulo de la cuadrícula en O(1).
+ *
+ * @param row Fila superior del rectángulo.
+ * @param col Columna izquierda del rectángulo.
+ * @param height Número de filas del rectángulo.
+ * @param width Número de columnas del rectángulo.
+ * @return Número de obstáculos en el rectángulo.
+ */
+int GridGraph::countObstacles(const int row, const int col, const int height, const int width) const {
+    updateObstacleSums();
+
+    const int stride = cols + 1;
+    const int top = row * stride;
+    const int bottom = (row + height) * stride;
+    return obstacleSums[bottom + col + width] - obstacleSums[top + col + width]
+         - obstacleSums[bottom + col] + obstacleSums[top + col];
 }
@@ -0,0 +1,429 @@
+#include "systems/HierarchicalPathfinder.h"
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Prioridad de A* para el montículo: f en la parte alta y h en la baja (desempate hacia el destino).
+     */
+    long long abstractKey(const int g, const int h) {
+        return (static_cast<long long>(g + h) << 32) | h;
+    }
+}
+
+HierarchicalPathfinder::HierarchicalPathfinder(const GridGraph& graph, const int clusterSize)
+    : graph(graph), clusterSize(clusterSize) {
+    if (clusterSize < 2) {
+        throw std::invalid_argument("El lado de los clusters debe ser al menos 2");
+    }
+}
+
+int HierarchicalPathfinder::clusterOf(const int row, const int col) const {
+    return (row / clusterSize) * clusterCols + col / clusterSize;
+}
+
+int HierarchicalPathfinder::localIndex(const Cluster& cluster, const int id) const {
+    return (id / graph.getCols() - cluster.firstRow) * cluster.cols + id % graph.getCols() - cluster.firstCol;
+}
+
+/**
+ * @brief Añade a un cluster las entradas de una de sus fronteras.
+ *
+ * Recorre la línea de celdas del cluster pegada a la frontera junto con la línea contigua del cluster
+ * vecino y, por cada tramo en el que ambas están libres, añade una entrada en el centro (tramos cortos)
+ * o dos en los extremos (tramos de SINGLE_ENTRANCE_LENGTH celdas o más). El vecino obtiene las mismas
+ * posiciones al recorrer la frontera desde su lado.
+ *
+ * @param clusterIndex Cluster al que se añaden las entradas.
+ * @param side Frontera: 0 arriba, 1 abajo, 2 izquierda, 3 derecha.
+ */
+void HierarchicalPathfinder::collectBorderEntrances(const int clusterIndex, const int side) {
+    Cluster& cluster = clusters[clusterIndex];
+
+    // Celda inicial de la línea, paso a lo largo de ella y desplazamiento hacia el vecino
+    int row = side == 1 ? cluster.firstRow + cluster.rows - 1 : cluster.firstRow;
+    int col = side == 3 ? cluster.firstCol + cluster.cols - 1 : cluster.firstCol;
+    const int stepRow = side >= 2 ? 1 : 0;
+    const int stepCol = side >= 2 ? 0 : 1;
+    const int otherRow = side == 0 ? -1 : side == 1 ? 1 : 0;
+    const int otherCol = side == 2 ? -1 : side == 3 ? 1 : 0;
+    const int length = side >= 2 ? cluster.rows : cluster.cols;
+
+    if (!graph.isValid(row + otherRow, col + otherCol)) {
+        return;
+    }
+
+    auto addEntrance = [&](const int offset) {
+        const int id = graph.toIndex(row + offset * stepRow, col + offset * stepCol);
+        if (entranceSlot[id] == -1) {
+            entranceSlot[id] = cluster.entrances.size();
+            cluster.entrances.push_back(id);
+        }
+    };
+
+    int runStart = -1;
+    for (int offset = 0; offset <= length; ++offset) {
+        const int lineRow = row + offset * stepRow;
+        const int lineCol = col + offset * stepCol;
+        const bool open = offset < length && !graph.isObstacle(lineRow, lineCol)
+                          && !graph.isObstacle(lineRow + otherRow, lineCol + otherCol);
+        if (open && runStart == -1) {
+            runStart = offset;
+        } else if (!open && runStart != -1) {
+            const int runEnd = offset - 1;
+            if (runEnd - runStart + 1 < SINGLE_ENTRANCE_LENGTH) {
+                addEntrance((runStart + runEnd) / 2);
+            } else {
+                addEntrance(runStart);
+                addEntrance(runEnd);
+            }
+            runStart = -1;
+        }
+    }
+}
+
+/**
+ * @brief Recalcula las entradas de un cluster y las distancias internas entre ellas.
+ *
+ * Hace una BFS limitada al cluster desde cada entrada; la matriz es simétrica, así que cada BFS solo
+ * rellena las entradas posteriores.
+ *
+ * @param clusterIndex Cluster a reconstruir.
+ */
+void HierarchicalPathfinder::buildCluster(const int clusterIndex) {
+    Cluster& cluster = clusters[clusterIndex];
+    for (int i = 0; i < cluster.entrances.size(); ++i) {
+        entranceSlot[cluster.entrances[i]] = -1;
+    }
+    cluster.entrances.clear();
+
+    for (int side = 0; side < 4; ++side) {
+        collectBorderEntrances(clusterIndex, side);
+    }
+
+    const int count = cluster.entrances.size();
+    cluster.distances.resize(count * count);
+    for (int i = 0; i < count; ++i) {
+        searchCluster(clusterIndex, cluster.entrances[i], -1);
+        for (int j = i; j < count; ++j) {
+            const int distance = localDistance[localIndex(cluster, cluster.entrances[j])];
+            cluster.distances[i * count + j] = distance;
+            cluster.distances[j * count + i] = distance;
+        }
+    }
+}
+
+void HierarchicalPathfinder::buildAll() {
+    const int rows = graph.getRows();
+    const int cols = graph.getCols();
+    clusterRows = (rows + clusterSize - 1) / clusterSize;
+    clusterCols = (cols + clusterSize - 1) / clusterSize;
+
+    clusters = DynamicArray<Cluster>(clusterRows * clusterCols);
+    for (int index = 0; index < clusters.size(); ++index) {
+        Cluster& cluster = clusters[index];
+        cluster.firstRow = (index / clusterCols) * clusterSize;
+        cluster.firstCol = (index % clusterCols) * clusterSize;
+        cluster.rows = std::min(clusterSize, rows - cluster.firstRow);
+        cluster.cols = std::min(clusterSize, cols - cluster.firstCol);
+    }
+
+    entranceSlot.resize(rows * cols);
+    for (int id = 0; id < rows * cols; ++id) {
+        entranceSlot[id] = -1;
+    }
+    localDistance.resize(clusterSize * clusterSize);
+    localParent.resize(clusterSize * clusterSize);
+    localQueue.resize(clusterSize * clusterSize);
+    dirty = DynamicArray<unsigned char>(clusters.size());
+    dirtyClusters.clear();
+
+    for (int index = 0; index < clusters.size(); ++index) {
+        buildCluster(index);
+    }
+
+    built = true;
+    builtVersion = graph.getMapVersion();
+    pendingChanges = 0;
+}
+
+void HierarchicalPathfinder::build() {
+    buildAll();
+}
+
+/**
+ * @brief Reconstruye los clusters marcados por cellChanged().
+ *
+ * Si el número de cambios avisados no explica la versión actual del mapa (cambios sin avisar o un mapa
+ * de otras dimensiones), reconstruye todo.
+ */
+void HierarchicalPathfinder::ensureUpToDate() {
+    if (!built || entranceSlot.size() != graph.getRows() * graph.getCols()
+        || graph.getMapVersion() != builtVersion + pendingChanges) {
+        buildAll();
+        return;
+    }
+
+    for (int i = 0; i < dirtyClusters.size(); ++i) {
+        buildCluster(dirtyClusters[i]);
+        dirty[dirtyClusters[i]] = 0;
+    }
+    dirtyClusters.clear();
+    builtVersion = graph.getMapVersion();
+    pendingChanges = 0;
+}
+
+/**
+ * @brief Marca los clusters afectados por un cambio de accesibilidad.
+ *
+ * Siempre se marca el cluster de la celda; si la celda está en una frontera también se marca el vecino,
+ * porque las entradas de esa frontera dependen de ambos lados.
+ */
+void HierarchicalPathfinder::cellChanged(const int row, const int col) {
+    if (!built) {
+        return;
+    }
+    ++pendingChanges;
+
+    auto mark = [&](const int clusterRow, const int clusterCol) {
+        const int index = graph.isValid(clusterRow, clusterCol) ? clusterOf(clusterRow, clusterCol) : -1;
+        if (index != -1 && !dirty[index]) {
+            dirty[index] = 1;
+            dirtyClusters.push_back(index);
+        }
+    };
+
+    mark(row, col);
+    if (row % clusterSize == 0) {
+        mark(row - 1, col);
+    }
+    if (row % clusterSize == clusterSize - 1) {
+        mark(row + 1, col);
+    }
+    if (col % clusterSize == 0) {
+        mark(row, col - 1);
+    }
+    if (col % clusterSize == clusterSize - 1) {
+        mark(row, col + 1);
+    }
+}
+
+/**
+ * @brief BFS limitada a un cluster; deja distancias y padres indexados por posición local.
+ *
+ * La cola y los padres trabajan con índices locales, de modo que los límites del cluster se comprueban
+ * sin convertir IDs de celda.
+ */
+void HierarchicalPathfinder::searchCluster(const int clusterIndex, const int source, const int target) {
+    const Cluster& cluster = clusters[clusterIndex];
+    const int cols = graph.getCols();
+    for (int i = 0; i < cluster.rows * cluster.cols; ++i) {
+        localDistance[i] = -1;
+    }
+
+    const int localSource = localIndex(cluster, source);
+    const int localTarget = target == -1 ? -1 : localIndex(cluster, target);
+    int head = 0;
+    int tail = 0;
+    localDistance[localSource] = 0;
+    localParent[localSource] = -1;
+    localQueue[tail++] = localSource;
+
+    while (head < tail) {
+        const int current = localQueue[head++];
+        if (current == localTarget) {
+            return;
+        }
+
+        const int localRow = current / cluster.cols;
+        const int localCol = current % cluster.cols;
+        const int nextDist = localDistance[current] + 1;
+        const unsigned char mask = graph.getNeighborMask((cluster.firstRow + localRow) * cols + cluster.firstCol + localCol);
+        for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+            const int row = localRow + GridGraph::NEIGHBOR_ROW_OFFSETS[direction];
+            const int col = localCol + GridGraph::NEIGHBOR_COL_OFFSETS[direction];
+            if (!(mask & (1 << direction)) || row < 0 || row >= cluster.rows || col < 0 || col >= cluster.cols) {
+                continue;
+            }
+
+            const int neighbor = row * cluster.cols + col;
+            if (localDistance[neighbor] == -1) {
+                localDistance[neighbor] = nextDist;
+                localParent[neighbor] = current;
+                localQueue[tail++] = neighbor;
+            }
+        }
+    }
+}
+
+bool HierarchicalPathfinder::appendClusterPath(const int clusterIndex, const int a, const int b, Path& path) {
+    const Cluster& cluster = clusters[clusterIndex];
+    searchCluster(clusterIndex, a, b);
+    const int distance = localDistance[localIndex(cluster, b)];
+    if (distance == -1) {
+        return false;
+    }
+
+    // Reservar el tramo y rellenarlo desde el final siguiendo los padres
+    const int base = path.size();
+    for (int i = 0; i < distance; ++i) {
+        path.push_back(Position{});
+    }
+    const int localSource = localIndex(cluster, a);
+    for (int at = localIndex(cluster, b), index = base + distance - 1; at != localSource; at = localParent[at], --index) {
+        path[index] = Position{cluster.firstRow + at / cluster.cols, cluster.firstCol + at % cluster.cols};
+    }
+    return true;
+}
+
+/**
+ * @brief Busca un camino casi óptimo: A* sobre las entradas y refinamiento de cada tramo dentro de su cluster.
+ *
+ * El origen y el destino se conectan temporalmente a las entradas de sus clusters con una BFS interna. Si
+ * ambos están en el mismo cluster y hay camino interno, se usa directamente.
+ *
+ * No consulta las componentes conexas del mapa, cuyo reetiquetado tras cualquier cambio recorre todas las
+ * celdas: sin camino, el A* abstracto agota la parte del grafo de entradas que alcanza y devuelve vacío.
+ */
+Path HierarchicalPathfinder::findPath(const Position src, const Position dest) {
+    if (!graph.isValid(src.row, src.column) || !graph.isValid(dest.row, dest.column)
+        || graph.isObstacle(src.row, src.column) || graph.isObstacle(dest.row, dest.column)) {
+        return {};
+    }
+
+    const int cols = graph.getCols();
+    const int startId = graph.toIndex(src.row, src.column);
+    const int goalId = graph.toIndex(dest.row, dest.column);
+    expandedNodes = 0;
+
+    Path path;
+    path.push_back(src);
+    if (startId == goalId) {
+        return path;
+    }
+
+    ensureUpToDate();
+
+    const int startCluster = clusterOf(src.row, src.column);
+    const int goalCluster = clusterOf(dest.row, dest.column);
+    if (startCluster == goalCluster && appendClusterPath(startCluster, startId, goalId, path)) {
+        return path;
+    }
+
+    // Conectar el origen y el destino a las entradas de sus clusters
+    const Cluster& first = clusters[startCluster];
+    searchCluster(startCluster, startId, -1);
+    startDistance.resize(first.entrances.size());
+    for (int i = 0; i < first.entrances.size(); ++i) {
+        startDistance[i] = localDistance[localIndex(first, first.entrances[i])];
+    }
+
+    const Cluster& last = clusters[goalCluster];
+    searchCluster(goalCluster, goalId, -1);
+    goalDistance.resize(last.entrances.size());
+    for (int i = 0; i < last.entrances.size(); ++i) {
+        goalDistance[i] = localDistance[localIndex(last, last.entrances[i])];
+    }
+
+    // A* sobre el grafo abstracto; la distancia Manhattan nunca supera el coste de una arista
+    auto heuristic = [&](const int id) {
+        return std::abs(id / cols - dest.row) + std::abs(id % cols - dest.column);
+    };
+    workspace.begin(graph.getRows() * cols);
+    IndexedPriorityQueue<long long>& open = workspace.open;
+    auto relax = [&](const int from, const int to, const int g) {
+        if (g < workspace.getDistance(to)) {
+            workspace.visit(to, from, g);
+            open.pushOrDecrease(to, abstractKey(g, heuristic(to)));
+        }
+    };
+
+    workspace.visit(startId, -1, 0);
+    open.pushOrDecrease(startId, abstractKey(0, heuristic(startId)));
+    bool found = false;
+
+    while (!open.empty()) {
+        const int id = open.pop();
+        ++expandedNodes;
+        if (id == goalId) {
+            found = true;
+            break;
+        }
+
+        const int g = workspace.getDistance(id);
+        if (id == startId) {
+            for (int i = 0; i < first.entrances.size(); ++i) {
+                if (startDistance[i] >= 0) {
+                    relax(id, first.entrances[i], g + startDistance[i]);
+                }
+            }
+        }
+
+        const int slot = entranceSlot[id];
+        if (slot == -1) {
+            continue;
+        }
+
+        // Aristas internas del cluster, aristas entre clusters y, en el cluster del destino, el destino
+        const int clusterIndex = clusterOf(id / cols, id % cols);
+        const Cluster& cluster = clusters[clusterIndex];
+        const int count = cluster.entrances.size();
+        for (int j = 0; j < count; ++j) {
+            if (const int distance = cluster.distances[slot * count + j]; distance > 0) {
+                relax(id, cluster.entrances[j], g + distance);
+            }
+        }
+
+        const unsigned char mask = graph.getNeighborMask(id);
+        for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+            if (!(mask & (1 << direction))) {
+                continue;
+            }
+            const int neighbor = graph.getNeighborId(id, direction);
+            if (entranceSlot[neighbor] != -1 && clusterOf(neighbor / cols, neighbor % cols) != clusterIndex) {
+                relax(id, neighbor, g + 1);
+            }
+        }
+
+        if (clusterIndex == goalCluster && goalDistance[slot] >= 0) {
+            relax(id, goalId, g + goalDistance[slot]);
+        }
+    }
+
+    if (!found) {
+        return {};
+    }
+
+    // Camino abstracto en orden de recorrido
+    waypoints.clear();
+    for (int at = goalId; at != -1; at = workspace.getParent(at)) {
+        waypoints.push_back(at);
+    }
+
+    // Refinamiento: cada tramo une celdas adyacentes o dos celdas de un mismo cluster
+    for (int i = waypoints.size() - 1; i > 0; --i) {
+        const int a = waypoints[i];
+        const int b = waypoints[i - 1];
+        if (std::abs(a / cols - b / cols) + std::abs(a % cols - b % cols) == 1) {
+            path.push_back(Position{b / cols, b % cols});
+        } else if (!appendClusterPath(clusterOf(b / cols, b % cols), a, b, path)) {
+            return {};
+        }
+    }
+    return path;
+}
+
+int HierarchicalPathfinder::getEntranceCount() const {
+    int count = 0;
+    for (int i = 0; i < clusters.size(); ++i) {
+        count += clusters[i].entrances.size();
+    }
+    return count;
+}
+
+int HierarchicalPathfinder::getExpandedNodeCount() const {
+    return expandedNodes;
+}
@@ -0,0 +1,312 @@
+#include "systems/MapCorpus.h"
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    /**
+     * @brief Lee un entero sin signo de 16 bits en little-endian.
+     */
+    unsigned int readU16(const unsigned char* bytes) {
+        return bytes[0] | (bytes[1] << 8);
+    }
+
+    /**
+     * @brief Lee un entero sin signo de 32 bits en little-endian.
+     */
+    unsigned int readU32(const unsigned char* bytes) {
+        return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<unsigned int>(bytes[3]) << 24);
+    }
+
+    /**
+     * @brief Escribe un entero sin signo de 16 bits en little-endian.
+     */
+    void writeU16(unsigned char* bytes, const unsigned int value) {
+        bytes[0] = value & 0xFF;
+        bytes[1] = (value >> 8) & 0xFF;
+    }
+
+    /**
+     * @brief Escribe un entero sin signo de 32 bits en little-endian.
+     */
+    void writeU32(unsigned char* bytes, const unsigned int value) {
+        for (int i = 0; i < 4; ++i) {
+            bytes[i] = (value >> (8 * i)) & 0xFF;
+        }
+    }
+
+    /**
+     * @brief Redondea un tamaño al siguiente múltiplo de MapFormat::ALIGNMENT.
+     */
+    std::size_t align(const std::size_t size) {
+        return (size + MapFormat::ALIGNMENT - 1) / MapFormat::ALIGNMENT * MapFormat::ALIGNMENT;
+    }
+
+    /**
+     * @brief Verifica un bit de un plano empaquetado.
+     */
+    bool testBit(const unsigned char* plane, const int id) {
+        return plane[id >> 3] & (1 << (id & 7));
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// MapView
+// ---------------------------------------------------------------------------------------------------------------------
+
+MapView::MapView(const unsigned char* record, const unsigned char* safePlane, const int rows, const int cols)
+    : record(record), safePlane(safePlane), rows(rows), cols(cols) {}
+
+int MapView::getRows() const {
+    return rows;
+}
+
+int MapView::getCols() const {
+    return cols;
+}
+
+unsigned int MapView::getSeed() const {
+    return readU32(record);
+}
+
+int MapView::getObstacleCount() const {
+    return static_cast<int>(readU32(record + 4));
+}
+
+int MapView::getComponentCount() const {
+    return static_cast<int>(readU32(record + 8));
+}
+
+int MapView::getChokepointCount() const {
+    return static_cast<int>(readU32(record + 12));
+}
+
+bool MapView::isObstacle(const int row, const int col) const {
+    return testBit(getObstaclePlane(), row * cols + col);
+}
+
+bool MapView::isSafeNode(const int row, const int col) const {
+    return testBit(safePlane, row * cols + col);
+}
+
+const unsigned char* MapView::getObstaclePlane() const {
+    return record + MapFormat::RECORD_METADATA_SIZE;
+}
+
+/**
+ * @brief Copia la accesibilidad del mapa en un GridGraph de las mismas dimensiones.
+ *
+ * Las máscaras de vecinos se actualizan de forma incremental, por lo que recargar mapas parecidos
+ * sobre el mismo grafo solo toca las celdas que cambian.
+ *
+ * @param graph Grafo de destino.
+ */
+void MapView::loadInto(GridGraph& graph) const {
+    if (graph.getRows() != rows || graph.getCols() != cols) {
+        throw std::invalid_argument("Las dimensiones del grafo no coinciden con las del mapa");
+    }
+
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            graph.setNodeAccessibility(row, col, !isObstacle(row, col));
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// MapCorpus
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Abre y valida una colección de mapas proyectándola en memoria.
+ *
+ * @param path Ruta del archivo.
+ */
+MapCorpus::MapCorpus(const std::string& path) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw std::runtime_error("No se pudo abrir la colección de mapas: " + path);
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) == -1 || info.st_size < MapFormat::HEADER_SIZE) {
+        ::close(fd);
+        throw std::runtime_error("Colección de mapas truncada: " + path);
+    }
+    fileSize = static_cast<std::size_t>(info.st_size);
+
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("No se pudo proyectar la colección de mapas: " + path);
+    }
+    data = static_cast<const unsigned char*>(mapping);
+
+    // Validar la cabecera
+    const std::size_t planeBytes = readU32(data + 24);
+    rows = static_cast<int>(readU32(data + 8));
+    cols = static_cast<int>(readU32(data + 12));
+    mapCount = static_cast<int>(readU32(data + 16));
+    recordSize = static_cast<int>(readU32(data + 20));
+
+    const char* error = nullptr;
+    if (std::memcmp(data, MapFormat::MAGIC, sizeof(MapFormat::MAGIC)) != 0) {
+        error = "Firma de colección de mapas no válida: ";
+    } else if (readU16(data + 4) != MapFormat::VERSION) {
+        error = "Versión de colección de mapas no soportada: ";
+    } else if (readU16(data + 6) != MapFormat::HEADER_SIZE || rows < GridGraph::MIN_ROWS || cols < GridGraph::MIN_COLS
+        || mapCount < 0 || planeBytes != (static_cast<std::size_t>(rows) * cols + 7) / 8
+        || static_cast<std::size_t>(recordSize) != align(MapFormat::RECORD_METADATA_SIZE + planeBytes)) {
+        error = "Cabecera de colección de mapas no válida: ";
+    } else {
+        const std::size_t recordsOffset = align(MapFormat::HEADER_SIZE + planeBytes);
+        if (fileSize < recordsOffset + static_cast<std::size_t>(mapCount) * recordSize) {
+            error = "Colección de mapas truncada: ";
+        } else {
+            safePlane = data + MapFormat::HEADER_SIZE;
+            records = data + recordsOffset;
+        }
+    }
+
+    if (error != nullptr) {
+        munmap(const_cast<unsigned char*>(data), fileSize);
+        throw std::runtime_error(error + path);
+    }
+}
+
+MapCorpus::~MapCorpus() {
+    munmap(const_cast<unsigned char*>(data), fileSize);
+}
+
+int MapCorpus::getMapCount() const {
+    return mapCount;
+}
+
+int MapCorpus::getRows() const {
+    return rows;
+}
+
+int MapCorpus::getCols() const {
+    return cols;
+}
+
+MapView MapCorpus::getMap(const int index) const {
+    if (index < 0 || index >= mapCount) {
+        throw std::out_of_range("Índice de mapa fuera de rango");
+    }
+    return MapView(records + static_cast<std::size_t>(index) * recordSize, safePlane, rows, cols);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// MapCorpusWriter
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Crea el archivo y escribe la cabecera y el plano de nodos seguros.
+ *
+ * El número de mapas de la cabecera queda en 0 hasta que se llama a close().
+ *
+ * @param path Ruta del archivo.
+ * @param rows Número de filas de cada mapa.
+ * @param cols Número de columnas de cada mapa.
+ */
+MapCorpusWriter::MapCorpusWriter(const std::string& path, const int rows, const int cols)
+    : out(path, std::ios::binary | std::ios::trunc), scratch(rows, cols), rows(rows), cols(cols),
+      planeBytes((rows * cols + 7) / 8),
+      recordSize(static_cast<int>(align(MapFormat::RECORD_METADATA_SIZE + planeBytes))) {
+    if (!out) {
+        throw std::runtime_error("No se pudo crear la colección de mapas: " + path);
+    }
+
+    // Cabecera, plano de nodos seguros y relleno hasta la sección de registros
+    DATA_STRUCTURES::DynamicArray<unsigned char> prefix(static_cast<int>(align(MapFormat::HEADER_SIZE + planeBytes)));
+    std::memcpy(&prefix[0], MapFormat::MAGIC, sizeof(MapFormat::MAGIC));
+    writeU16(&prefix[4], MapFormat::VERSION);
+    writeU16(&prefix[6], MapFormat::HEADER_SIZE);
+    writeU32(&prefix[8], rows);
+    writeU32(&prefix[12], cols);
+    writeU32(&prefix[16], 0);
+    writeU32(&prefix[20], recordSize);
+    writeU32(&prefix[24], planeBytes);
+
+    for (int id = 0; id < rows * cols; ++id) {
+        if (scratch.isSafeNode(id)) {
+            prefix[MapFormat::HEADER_SIZE + (id >> 3)] |= 1 << (id & 7);
+        }
+    }
+
+    out.write(reinterpret_cast<const char*>(&prefix[0]), prefix.size());
+}
+
+MapCorpusWriter::~MapCorpusWriter() {
+    if (out.is_open()) {
+        try {
+            close();
+        } catch (const std::exception&) {
+            // Un destructor no debe propagar excepciones
+        }
+    }
+}
+
+/**
+ * @brief Añade un mapa a la colección junto con sus metadatos precalculados.
+ *
+ * @param graph Mapa a guardar.
+ * @param seed Semilla con la que se generó.
+ */
+void MapCorpusWriter::append(const GridGraph& graph, const unsigned int seed) {
+    if (graph.getRows() != rows || graph.getCols() != cols) {
+        throw std::invalid_argument("Las dimensiones del mapa no coinciden con las de la colección");
+    }
+
+    DATA_STRUCTURES::DynamicArray<unsigned char> record(recordSize);
+    int obstacleCount = 0;
+    for (int id = 0; id < rows * cols; ++id) {
+        if (graph.isObstacle(id / cols, id % cols)) {
+            record[MapFormat::RECORD_METADATA_SIZE + (id >> 3)] |= 1 << (id & 7);
+            ++obstacleCount;
+        }
+    }
+
+    writeU32(&record[0], seed);
+    writeU32(&record[4], obstacleCount);
+    writeU32(&record[8], graph.getComponentCount());
+    writeU32(&record[12], graph.getChokepoints().size());
+
+    out.write(reinterpret_cast<const char*>(&record[0]), recordSize);
+    ++mapCount;
+}
+
+/**
+ * @brief Añade todos los mapas de un lote, conservando sus semillas.
+ *
+ * @param farm Lote de mapas.
+ */
+void MapCorpusWriter::append(const MapFarm& farm) {
+    if (farm.getRows() != rows || farm.getCols() != cols) {
+        throw std::invalid_argument("Las dimensiones del lote no coinciden con las de la colección");
+    }
+
+    for (int map = 0; map < farm.getMapCount(); ++map) {
+        farm.loadMap(map, scratch);
+        append(scratch, farm.getSeed(map));
+    }
+}
+
+/**
+ * @brief Actualiza el número de mapas de la cabecera y cierra el archivo.
+ */
+void MapCorpusWriter::close() {
+    unsigned char count[4];
+    writeU32(count, mapCount);
+    out.seekp(16);
+    out.write(reinterpret_cast<const char*>(count), sizeof(count));
+    out.close();
+
+    if (!out) {
+        throw std::runtime_error("Error al escribir la colección de mapas");
+    }
+}
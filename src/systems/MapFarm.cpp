@@ -0,0 +1,136 @@
+#include "systems/MapFarm.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    constexpr int MAPS_PER_CHUNK = 64; ///< Mapas que un hilo reclama de una vez.
+}
+
+MapFarm::MapFarm(const int rows, const int cols)
+    : rows(rows), cols(cols), bytesPerMap((rows * cols + 7) / 8) {
+    if (rows < GridGraph::MIN_ROWS || cols < GridGraph::MIN_COLS) {
+        throw std::invalid_argument("Dimensiones de la cuadrícula demasiado pequeñas");
+    }
+}
+
+/**
+ * @brief Genera un lote de mapas repartiendo el trabajo entre varios hilos.
+ *
+ * Los hilos reclaman bloques de MAPS_PER_CHUNK mapas de un contador atómico y escriben cada mapa en su
+ * posición fija del bloque contiguo, por lo que no necesitan más sincronización.
+ *
+ * @param count Número de mapas a generar.
+ * @param seed Semilla del primer mapa.
+ * @param threadCount Número de hilos (0 para usar todos los núcleos disponibles).
+ */
+void MapFarm::generate(const int count, const unsigned int seed, int threadCount) {
+    if (count < 0 || (count > 0 && bytesPerMap > INT_MAX / count)) {
+        throw std::length_error("El lote de mapas es demasiado grande");
+    }
+
+    mapCount = count;
+    baseSeed = seed;
+    bits.clear();
+    bits.resize(count * bytesPerMap);
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    const int chunkCount = (count + MAPS_PER_CHUNK - 1) / MAPS_PER_CHUNK;
+    threadCount = std::min(threadCount, chunkCount);
+
+    if (threadCount <= 1) {
+        generateRange(0, count);
+        return;
+    }
+
+    std::atomic<int> nextChunk{0};
+    auto worker = [&]() {
+        for (int chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+            const int first = chunk * MAPS_PER_CHUNK;
+            generateRange(first, std::min(first + MAPS_PER_CHUNK, count));
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Genera y empaqueta los mapas del rango [first, last).
+ *
+ * @param first Índice del primer mapa.
+ * @param last Índice siguiente al último mapa.
+ */
+void MapFarm::generateRange(const int first, const int last) {
+    for (int map = first; map < last; ++map) {
+        GridGraph graph(rows, cols);
+        graph.generateObstacles(getSeed(map));
+
+        unsigned char* out = &bits[map * bytesPerMap];
+        for (int id = 0; id < rows * cols; ++id) {
+            if (!graph.isObstacle(id / cols, id % cols)) {
+                out[id >> 3] |= 1 << (id & 7);
+            }
+        }
+    }
+}
+
+int MapFarm::getMapCount() const {
+    return mapCount;
+}
+
+int MapFarm::getRows() const {
+    return rows;
+}
+
+int MapFarm::getCols() const {
+    return cols;
+}
+
+int MapFarm::getBytesPerMap() const {
+    return bytesPerMap;
+}
+
+unsigned int MapFarm::getSeed(const int map) const {
+    return baseSeed + static_cast<unsigned int>(map);
+}
+
+const unsigned char* MapFarm::getMapData(const int map) const {
+    return &bits[map * bytesPerMap];
+}
+
+bool MapFarm::isWalkable(const int map, const int row, const int col) const {
+    const int id = row * cols + col;
+    return bits[map * bytesPerMap + (id >> 3)] & (1 << (id & 7));
+}
+
+/**
+ * @brief Copia la accesibilidad de un mapa del lote en un GridGraph de las mismas dimensiones.
+ *
+ * @param map Índice del mapa.
+ * @param graph Grafo de destino.
+ */
+void MapFarm::loadMap(const int map, GridGraph& graph) const {
+    if (graph.getRows() != rows || graph.getCols() != cols) {
+        throw std::invalid_argument("Las dimensiones del grafo no coinciden con las del lote");
+    }
+
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            graph.setNodeAccessibility(row, col, isWalkable(map, row, col));
+        }
+    }
+}
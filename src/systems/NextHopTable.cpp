@@ -0,0 +1,162 @@
+#include "systems/NextHopTable.h"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    constexpr int SOURCES_PER_CHUNK = 16; ///< Orígenes que un hilo reclama de una vez.
+}
+
+NextHopTable::NextHopTable(const GridGraph& graph, const int maxCells) : graph(graph), maxCells(0) {
+    setMaxCells(maxCells);
+}
+
+/**
+ * @brief Construye la tabla repartiendo los orígenes entre varios hilos.
+ *
+ * Los hilos reclaman bloques de SOURCES_PER_CHUNK orígenes de un contador atómico; cada origen escribe
+ * solo en su propia fila de la tabla, así que no hace falta más sincronización. El grafo solo se lee.
+ *
+ * @param threadCount Número de hilos (0 para usar todos los núcleos disponibles).
+ * @return true si se construyó; false si el mapa supera maxCells.
+ */
+bool NextHopTable::build(int threadCount) {
+    built = false;
+    nodeCount = graph.getRows() * graph.getCols();
+    if (nodeCount > maxCells) {
+        distances = DynamicArray<unsigned short>();
+        nextHops = DynamicArray<unsigned char>();
+        return false;
+    }
+
+    distances.resize(nodeCount * nodeCount);
+    nextHops.resize(nodeCount * nodeCount);
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    const int chunkCount = (nodeCount + SOURCES_PER_CHUNK - 1) / SOURCES_PER_CHUNK;
+    threadCount = std::min(threadCount, chunkCount);
+
+    if (threadCount <= 1) {
+        DynamicArray<int> queue(nodeCount);
+        buildRange(0, nodeCount, queue);
+    } else {
+        std::atomic<int> nextChunk{0};
+        auto worker = [&]() {
+            DynamicArray<int> queue(nodeCount);
+            for (int chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+                const int first = chunk * SOURCES_PER_CHUNK;
+                buildRange(first, std::min(first + SOURCES_PER_CHUNK, nodeCount), queue);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount);
+        for (int i = 0; i < threadCount; ++i) {
+            workers.emplace_back(worker);
+        }
+        for (auto& thread : workers) {
+            thread.join();
+        }
+    }
+
+    builtVersion = graph.getMapVersion();
+    built = true;
+    return true;
+}
+
+/**
+ * @brief Rellena las filas de la tabla de los orígenes [first, last) con una BFS por origen.
+ *
+ * El primer paso hacia cada celda se hereda de su padre en el árbol de la BFS, salvo en los vecinos
+ * directos del origen, que lo fijan con su propia dirección.
+ */
+void NextHopTable::buildRange(const int first, const int last, DynamicArray<int>& queue) {
+    for (int source = first; source < last; ++source) {
+        unsigned short* distanceRow = &distances[source * nodeCount];
+        unsigned char* hopRow = &nextHops[source * nodeCount];
+        std::fill(distanceRow, distanceRow + nodeCount, UNREACHABLE);
+        std::fill(hopRow, hopRow + nodeCount, NO_HOP);
+
+        if (graph.isObstacle(source / graph.getCols(), source % graph.getCols())) {
+            continue;
+        }
+
+        int head = 0;
+        int tail = 0;
+        distanceRow[source] = 0;
+        queue[tail++] = source;
+
+        while (head < tail) {
+            const int current = queue[head++];
+            const unsigned char mask = graph.getNeighborMask(current);
+            for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+                if (!(mask & (1 << direction))) {
+                    continue;
+                }
+                const int neighbor = graph.getNeighborId(current, direction);
+                if (distanceRow[neighbor] == UNREACHABLE) {
+                    distanceRow[neighbor] = distanceRow[current] + 1;
+                    hopRow[neighbor] = current == source ? direction : hopRow[current];
+                    queue[tail++] = neighbor;
+                }
+            }
+        }
+    }
+}
+
+bool NextHopTable::isValid() const {
+    return built && nodeCount == graph.getRows() * graph.getCols() && builtVersion == graph.getMapVersion();
+}
+
+int NextHopTable::getDistance(const Position src, const Position dest) const {
+    const unsigned short distance = distances[graph.toIndex(src.row, src.column) * nodeCount
+                                              + graph.toIndex(dest.row, dest.column)];
+    return distance == UNREACHABLE ? -1 : distance;
+}
+
+/**
+ * @brief Reconstruye un camino más corto siguiendo los saltos de la tabla.
+ *
+ * Cada salto lleva a una celda a un paso menos del destino, así que seguir las filas de las celdas
+ * intermedias produce un camino de longitud getDistance() + 1.
+ */
+Path NextHopTable::getPath(const Position src, const Position dest) const {
+    const int distance = getDistance(src, dest);
+    if (distance < 0) {
+        return {};
+    }
+
+    const int goalId = graph.toIndex(dest.row, dest.column);
+    Path path(distance + 1);
+    int current = graph.toIndex(src.row, src.column);
+    path[0] = src;
+    for (int step = 1; step <= distance; ++step) {
+        current = graph.getNeighborId(current, nextHops[current * nodeCount + goalId]);
+        path[step] = Position{current / graph.getCols(), current % graph.getCols()};
+    }
+    return path;
+}
+
+int NextHopTable::getMaxCells() const {
+    return maxCells;
+}
+
+void NextHopTable::setMaxCells(const int maxCells) {
+    if (maxCells < 0 || maxCells > MAX_CELLS_LIMIT) {
+        throw std::invalid_argument("Límite de celdas de la tabla de siguiente salto fuera de rango");
+    }
+    this->maxCells = maxCells;
+}
+
+std::size_t NextHopTable::getMemoryUsage() const {
+    if (!built) {
+        return 0;
+    }
+    return static_cast<std::size_t>(nodeCount) * nodeCount * (sizeof(unsigned short) + sizeof(unsigned char));
+}
@@ -0,0 +1,179 @@
+#include "systems/PathCache.h"
+#include <cstdint>
+#include <stdexcept>
+
+using namespace DATA_STRUCTURES;
+
+PathCache::PathCache(const GridGraph& graph, const int capacity)
+    : graph(graph), capacity(capacity), cachedMapVersion(graph.getMapVersion()),
+      cachedOccupancyVersion(graph.getOccupancyVersion()) {
+    if (capacity < 1) {
+        throw std::invalid_argument("La capacidad de la caché de caminos debe ser al menos 1");
+    }
+
+    entries.resize(capacity);
+    int bucketCount = 1;
+    while (bucketCount < capacity * 2) {
+        bucketCount *= 2;
+    }
+    buckets.resize(bucketCount);
+    for (int i = 0; i < bucketCount; ++i) {
+        buckets[i] = -1;
+    }
+}
+
+/**
+ * @brief Devuelve la cubeta de una clave mezclando sus campos con una multiplicación de Fibonacci.
+ */
+int PathCache::bucketOf(const PathAlgorithm algorithm, const Bitboard* blocked, const int sourceId,
+                        const int targetId) const {
+    unsigned long long key = static_cast<unsigned long long>(static_cast<unsigned int>(sourceId)) << 32
+                             | static_cast<unsigned int>(targetId);
+    key ^= static_cast<unsigned long long>(reinterpret_cast<std::uintptr_t>(blocked));
+    key = (key ^ static_cast<unsigned long long>(algorithm)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>((key >> 32) & static_cast<unsigned long long>(buckets.size() - 1));
+}
+
+void PathCache::checkVersions() {
+    if (cachedMapVersion != graph.getMapVersion() || cachedOccupancyVersion != graph.getOccupancyVersion()) {
+        clear();
+        cachedMapVersion = graph.getMapVersion();
+        cachedOccupancyVersion = graph.getOccupancyVersion();
+    }
+}
+
+void PathCache::unlink(const int index) {
+    Entry& entry = entries[index];
+    if (entry.previous != -1) {
+        entries[entry.previous].next = entry.next;
+    } else {
+        newest = entry.next;
+    }
+    if (entry.next != -1) {
+        entries[entry.next].previous = entry.previous;
+    } else {
+        oldest = entry.previous;
+    }
+}
+
+void PathCache::pushFront(const int index) {
+    Entry& entry = entries[index];
+    entry.previous = -1;
+    entry.next = newest;
+    if (newest != -1) {
+        entries[newest].previous = index;
+    } else {
+        oldest = index;
+    }
+    newest = index;
+}
+
+void PathCache::removeFromBucket(const int index) {
+    const Entry& entry = entries[index];
+    int* link = &buckets[bucketOf(entry.algorithm, entry.blocked, entry.sourceId, entry.targetId)];
+    while (*link != index) {
+        link = &entries[*link].nextInBucket;
+    }
+    *link = entry.nextInBucket;
+}
+
+const Path* PathCache::find(const PathAlgorithm algorithm, const Position src, const Position dest,
+                            const Bitboard* blocked) {
+    checkVersions();
+
+    const int sourceId = graph.toIndex(src.row, src.column);
+    const int targetId = graph.toIndex(dest.row, dest.column);
+    for (int index = buckets[bucketOf(algorithm, blocked, sourceId, targetId)]; index != -1;
+         index = entries[index].nextInBucket) {
+        const Entry& entry = entries[index];
+        if (entry.algorithm == algorithm && entry.blocked == blocked && entry.sourceId == sourceId
+            && entry.targetId == targetId
+            && entry.mapVersion == cachedMapVersion && entry.occupancyVersion == cachedOccupancyVersion) {
+            if (index != newest) {
+                unlink(index);
+                pushFront(index);
+            }
+            ++hits;
+            return &entry.path;
+        }
+    }
+
+    ++misses;
+    return nullptr;
+}
+
+/**
+ * @brief Guarda una copia de un camino, reemplazando la entrada menos reciente si la caché está llena.
+ *
+ * Si la clave ya estaba (dos store() seguidos sin find()), se sobrescribe su camino.
+ */
+void PathCache::store(const PathAlgorithm algorithm, const Position src, const Position dest, const Path& path,
+                      const Bitboard* blocked) {
+    checkVersions();
+
+    const int sourceId = graph.toIndex(src.row, src.column);
+    const int targetId = graph.toIndex(dest.row, dest.column);
+    const int bucket = bucketOf(algorithm, blocked, sourceId, targetId);
+
+    int index = buckets[bucket];
+    while (index != -1 && !(entries[index].algorithm == algorithm && entries[index].blocked == blocked
+                            && entries[index].sourceId == sourceId && entries[index].targetId == targetId)) {
+        index = entries[index].nextInBucket;
+    }
+
+    if (index != -1) {
+        unlink(index);
+    } else {
+        if (count < capacity) {
+            index = count++;
+        } else {
+            index = oldest;
+            unlink(index);
+            removeFromBucket(index);
+        }
+        Entry& entry = entries[index];
+        entry.algorithm = algorithm;
+        entry.blocked = blocked;
+        entry.sourceId = sourceId;
+        entry.targetId = targetId;
+        entry.nextInBucket = buckets[bucket];
+        buckets[bucket] = index;
+    }
+
+    Entry& entry = entries[index];
+    entry.mapVersion = cachedMapVersion;
+    entry.occupancyVersion = cachedOccupancyVersion;
+    entry.path = path;
+    entry.path.rewind();
+    pushFront(index);
+}
+
+/**
+ * @brief Elimina todos los caminos guardados sin tocar los contadores.
+ *
+ * Solo recorre las entradas en uso y las cubetas; los caminos se liberan al reutilizar cada entrada.
+ */
+void PathCache::clear() {
+    for (int i = 0; i < count; ++i) {
+        buckets[bucketOf(entries[i].algorithm, entries[i].blocked, entries[i].sourceId, entries[i].targetId)] = -1;
+    }
+    count = 0;
+    newest = -1;
+    oldest = -1;
+}
+
+int PathCache::size() const {
+    return count;
+}
+
+int PathCache::getCapacity() const {
+    return capacity;
+}
+
+long PathCache::getHitCount() const {
+    return hits;
+}
+
+long PathCache::getMissCount() const {
+    return misses;
+}
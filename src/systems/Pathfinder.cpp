@@ -1,216 +1,606 @@
 #include "../../include/systems/Pathfinder.h"
 
-#include <algorithm> // Para std::reverse
+#include <algorithm>
 #include <functional>
 #include <limits>
-#include <cstdlib>    // Para rand() y srand()
-#include <cstring>
-#include <ctime>      // Para time()
-#include <float.h>
+#include <cstdlib>
 #include <cmath>
-#include <set> // para la funcion A*
+#include <bit>
 
-#include "data_structures/LinkedList.h"
-#include "data_structures/Stack.h"
 #include "data_structures/PriorityQueue.h"
-#include "data_structures/Queue.h"
+#include "data_structures/IndexedPriorityQueue.h"
 #include "data_structures/DynamicArray.h"
 #include "data_structures/Pair.h"
+#include "data_structures/Bitboard.h"
 
 using namespace  std;
 using namespace DATA_STRUCTURES;
 
-#define ROW 13
-#define COL 25
-
 /**
  * @brief Constructor del Pathfinder.
  * @param g Referencia a un GridGraph.
  */
 Pathfinder::Pathfinder(GridGraph& g) : graph(g) {}
 
-Queue<Position>* convertStackToQueue(Stack<Position>& stack) {
-    auto* queue = new Queue<Position>();
-    while (!stack.empty()) {
-        queue->push(stack.top());
-        stack.pop();
+/**
+ * @brief Reconstruye en una sola pasada el camino registrado en el espacio de trabajo y lo añade a path.
+ *
+ * La longitud se conoce por la distancia del destino, así que el camino se reserva completo y se
+ * rellena desde el final siguiendo los padres.
+ *
+ * @param workspace Espacio de trabajo de la búsqueda que alcanzó el destino.
+ * @param cols Número de columnas de la cuadrícula.
+ * @param goalId ID del nodo de destino.
+ * @param path Camino al que se añaden las posiciones desde el origen hasta el destino.
+ */
+static void appendBuiltPath(const SearchWorkspace& workspace, const int cols, const int goalId, Path& path) {
+    const int start = path.size();
+    path.resize(start + workspace.getDistance(goalId) + 1);
+    int index = path.size() - 1;
+    for (int at = goalId; at != -1; at = workspace.getParent(at)) {
+        path[index--] = Position{at / cols, at % cols};
+    }
+}
+
+/**
+ * @brief Verifica si la máscara de bloqueo marca una celda; sin máscara no hay celdas bloqueadas.
+ */
+static bool isMasked(const Bitboard* blocked, const int id, const int cols) {
+    return blocked && blocked->test(id / cols, id % cols);
+}
+
+/**
+ * @brief Implementación de BFS para encontrar el camino más corto desde un nodo de inicio a un nodo de destino.
+ * @param src Posición de inicio.
+ * @param dest Posición de destino.
+ * @return true si se alcanzó el destino; los padres quedan en el espacio de trabajo.
+ */
+bool Pathfinder::searchBfs(const Position src, const Position dest, const Bitboard* blocked) {
+    int startId = graph.toIndex(src.row, src.column);
+    int goalId = graph.toIndex(dest.row, dest.column);
+
+    // Si los nodos están en componentes distintas no hay camino: evitar inundar el mapa
+    if (startId != goalId && (!graph.areConnected(startId, goalId) || isMasked(blocked, goalId, graph.getCols()))) {
+        return false;
+    }
+
+    // Iniciar BFS desde el nodo inicial; la cola del espacio de trabajo se recorre con dos índices
+    workspace.begin(graph.getRows() * graph.getCols());
+    DynamicArray<int>& q = workspace.queue;
+    int head = 0;
+    int tail = 0;
+    workspace.visit(startId, -1, 0);
+    q[tail++] = startId;
+    expandedNodes = 0;
+
+    while (head < tail) {
+        int current = q[head++];
+
+        // Las celdas bloqueadas se alcanzan pero no se expanden, así que ningún camino pasa por ellas
+        if (current != startId && isMasked(blocked, current, graph.getCols())) {
+            continue;
+        }
+        ++expandedNodes;
+
+        // Si llegamos al nodo objetivo, los padres quedan listos para reconstruir el camino.
+        if (current == goalId) {
+            return true;
+        }
+
+        // Explorar los nodos vecinos
+        const int nextDist = workspace.getDistance(current) + 1;
+        const unsigned char mask = graph.getNeighborMask(current);
+        for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+            if (!(mask & (1 << direction))) {
+                continue;
+            }
+            int neighbor = graph.getNeighborId(current, direction);
+            if (!workspace.isVisited(neighbor)) {
+                workspace.visit(neighbor, current, nextDist);
+                q[tail++] = neighbor;
+            }
+        }
     }
-    return queue;
+
+    return false;
 }
 
-LinkedList<Position>* convertStackToLinkedList(Stack<Position>& stack) {
-    auto* list = new LinkedList<Position>();
-    while (!stack.empty()) {
-        list->insertAt(0, stack.top()); // Inserta al inicio
-        stack.pop();
+Path Pathfinder::bfs(const Position src, const Position dest, const Bitboard* blocked) {
+    Path path;
+    if (searchBfs(src, dest, blocked)) {
+        appendBuiltPath(workspace, graph.getCols(), graph.toIndex(dest.row, dest.column), path);
     }
-    return list;
+    return path;
 }
 
-LinkedList<Position>* convertQueueToLinkedList(Queue<Position>* queue) {
-    if (!queue) {
-        return nullptr;
+/**
+ * @brief BFS bidireccional: alterna capas completas desde el origen y desde el destino hasta que se tocan.
+ *
+ * En cada paso expande la frontera más pequeña. Al expandir una capa se revisan todas sus aristas hacia
+ * nodos ya alcanzados por el otro lado y se conserva la unión más corta; como todos los nodos de la capa
+ * están a la misma distancia de su extremo, terminar la capa basta para garantizar el camino mínimo.
+ *
+ * @param src Posición de inicio.
+ * @param dest Posición de destino.
+ * @return Camino desde el inicio hasta el objetivo (vacío si no existe).
+ */
+Path Pathfinder::bidirectionalBfs(const Position src, const Position dest, const Bitboard* blocked) {
+    const int cols = graph.getCols();
+    const int startId = graph.toIndex(src.row, src.column);
+    const int goalId = graph.toIndex(dest.row, dest.column);
+
+    if (startId != goalId && (!graph.areConnected(startId, goalId) || isMasked(blocked, goalId, cols))) {
+        return {};
+    }
+
+    workspace.begin(graph.getRows() * cols);
+    reverseWorkspace.begin(graph.getRows() * cols);
+    workspace.visit(startId, -1, 0);
+    reverseWorkspace.visit(goalId, -1, 0);
+    workspace.queue[0] = startId;
+    reverseWorkspace.queue[0] = goalId;
+    int heads[2] = {0, 0};
+    int tails[2] = {1, 1};
+    expandedNodes = 0;
+
+    int forwardMeet = startId;
+    int backwardMeet = goalId;
+    bool met = startId == goalId;
+
+    while (!met && heads[0] < tails[0] && heads[1] < tails[1]) {
+        // Expandir la frontera más pequeña: 0 desde el origen, 1 desde el destino
+        const int side = tails[0] - heads[0] <= tails[1] - heads[1] ? 0 : 1;
+        SearchWorkspace& near = side == 0 ? workspace : reverseWorkspace;
+        const SearchWorkspace& far = side == 0 ? reverseWorkspace : workspace;
+        DynamicArray<int>& q = near.queue;
+
+        int bestLength = SearchWorkspace::INF;
+        const int layerEnd = tails[side];
+        while (heads[side] < layerEnd) {
+            const int current = q[heads[side]++];
+            if (current != startId && isMasked(blocked, current, cols)) {
+                continue;
+            }
+            ++expandedNodes;
+
+            const int nextDist = near.getDistance(current) + 1;
+            const unsigned char mask = graph.getNeighborMask(current);
+            for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+                if (!(mask & (1 << direction))) {
+                    continue;
+                }
+                const int neighbor = graph.getNeighborId(current, direction);
+                if (far.isVisited(neighbor) && nextDist + far.getDistance(neighbor) < bestLength
+                    && (neighbor == startId || !isMasked(blocked, neighbor, cols))) {
+                    bestLength = nextDist + far.getDistance(neighbor);
+                    forwardMeet = side == 0 ? current : neighbor;
+                    backwardMeet = side == 0 ? neighbor : current;
+                    met = true;
+                }
+                if (!near.isVisited(neighbor)) {
+                    near.visit(neighbor, current, nextDist);
+                    q[tails[side]++] = neighbor;
+                }
+            }
+        }
+    }
+
+    if (!met) {
+        return {};
     }
-    auto* list = new LinkedList<Position>();
-    while (!queue->empty()) {
-        list->append(queue->front());
-        queue->pop();
+
+    // Mitad del origen: se rellena hacia atrás desde el punto de encuentro
+    const int forwardLength = workspace.getDistance(forwardMeet) + 1;
+    const int backwardLength = forwardMeet == backwardMeet ? 0 : reverseWorkspace.getDistance(backwardMeet) + 1;
+    Path path(forwardLength + backwardLength);
+    int index = forwardLength - 1;
+    for (int at = forwardMeet; at != -1; at = workspace.getParent(at)) {
+        path[index--] = Position{at / cols, at % cols};
+    }
+
+    // Mitad del destino: los padres del árbol inverso ya apuntan hacia el destino
+    index = forwardLength;
+    for (int at = forwardMeet == backwardMeet ? -1 : backwardMeet; at != -1; at = reverseWorkspace.getParent(at)) {
+        path[index++] = Position{at / cols, at % cols};
     }
-    return list;
+    return path;
 }
 
-Queue<Position>* convertLinkedListToQueue(LinkedList<Position>& list) {
-    auto* queue = new Queue<Position>();
-    for (int i = 0; i < list.size(); i++) {
-        queue->push(list.at(i));
+/**
+ * @brief Expande en paralelo una capa de BFS sobre planos de bits.
+ *
+ * next recibe, para las filas [firstRow, lastRow], las celdas accesibles, no visitadas y no bloqueadas
+ * adyacentes a la frontera actual; las filas de next fuera de ese rango no se modifican. visited se
+ * actualiza con la nueva capa y cada celda de la capa recibe la distancia step.
+ *
+ * @param blocked Máscara de bloqueo, o nullptr.
+ * @param newFirstRow Recibe la primera fila con celdas en la nueva capa.
+ * @param newLastRow Recibe la última fila con celdas en la nueva capa (-1 si la capa está vacía).
+ */
+static void expandLayer(const Bitboard& frontier, const Bitboard& walkable, const Bitboard* blocked, Bitboard& visited,
+                        Bitboard& next, const int firstRow, const int lastRow, const int step,
+                        DynamicArray<int>& distances, int& newFirstRow, int& newLastRow) {
+    const int rows = frontier.getRows();
+    const int cols = frontier.getCols();
+    const int wordsPerRow = frontier.getWordsPerRow();
+    newFirstRow = rows;
+    newLastRow = -1;
+
+    for (int r = firstRow; r <= lastRow; ++r) {
+        const Bitboard::Word* center = frontier.row(r);
+        const Bitboard::Word* above = r > 0 ? frontier.row(r - 1) : nullptr;
+        const Bitboard::Word* below = r + 1 < rows ? frontier.row(r + 1) : nullptr;
+        const Bitboard::Word* open = walkable.row(r);
+        const Bitboard::Word* closed = blocked ? blocked->row(r) : nullptr;
+        Bitboard::Word* seen = visited.row(r);
+        Bitboard::Word* target = next.row(r);
+        bool rowActive = false;
+
+        for (int w = 0; w < wordsPerRow; ++w) {
+            const Bitboard::Word word = center[w];
+            Bitboard::Word grown = (word << 1) | (word >> 1);
+            if (w > 0) {
+                grown |= center[w - 1] >> (Bitboard::WORD_BITS - 1);
+            }
+            if (w + 1 < wordsPerRow) {
+                grown |= center[w + 1] << (Bitboard::WORD_BITS - 1);
+            }
+            if (above) {
+                grown |= above[w];
+            }
+            if (below) {
+                grown |= below[w];
+            }
+
+            // Los bits sobrantes de la última palabra nunca son accesibles, así que el desplazamiento no los activa
+            Bitboard::Word layer = grown & open[w] & ~seen[w];
+            if (closed) {
+                layer &= ~closed[w];
+            }
+            target[w] = layer;
+            if (layer == 0) {
+                continue;
+            }
+
+            seen[w] |= layer;
+            rowActive = true;
+            for (Bitboard::Word bits = layer; bits != 0; bits &= bits - 1) {
+                distances[r * cols + w * Bitboard::WORD_BITS + std::countr_zero(bits)] = step;
+            }
+        }
+
+        if (rowActive) {
+            newFirstRow = std::min(newFirstRow, r);
+            newLastRow = r;
+        }
     }
-    return queue;
 }
 
 /**
- * @brief Implementación de BFS para encontrar el camino más corto desde un nodo de inicio a un nodo de destino.
- * @param startId Identificador del nodo de inicio.
- * @param goalId Identificador del nodo objetivo.
- * @return Un vector con los nodos que forman el camino desde el inicio hasta el objetivo.
+ * @brief Calcula capas de BFS con operaciones por palabra y escribe la distancia de cada celda alcanzada.
+ *
+ * Cada paso solo recorre las filas vecinas a la frontera actual, que crece como mucho una fila por extremo.
+ * Los planos y las distancias son los del espacio de trabajo, así que iniciar la búsqueda solo limpia las
+ * filas que tocó la anterior.
+ *
+ * @param src Posición de inicio.
+ * @param goalId ID del nodo en el que detenerse, o -1 para recorrer toda la componente.
+ * @return Distancia hasta goalId, o -1 si no se alcanzó (o si goalId es -1).
  */
-LinkedList<Position>* Pathfinder::bfs(Position src, Position dest) {
-    DynamicArray<bool> visited(graph.getRows() * graph.getCols());
-    for (int i = 0; i < visited.size(); ++i) {
-        visited[i] = false;
+int Pathfinder::computeBitLayers(const Position src, const int goalId, const Bitboard* blocked) {
+    const int rows = graph.getRows();
+    const int cols = graph.getCols();
+    const Bitboard& walkable = graph.getWalkableBoard();
+    const int startId = graph.toIndex(src.row, src.column);
+
+    workspace.beginLayers(rows, cols);
+    DynamicArray<int>& distances = workspace.layerDistance;
+    workspace.touchRows(src.row, src.row);
+    distances[startId] = 0;
+    if (startId == goalId) {
+        return 0;
     }
+    if (graph.isObstacle(src.row, src.column)) {
+        return -1;
+    }
+
+    // Dos planos que se alternan como frontera y capa siguiente; las celdas bloqueadas nunca entran en una capa
+    Bitboard* frontier = &workspace.layers[0];
+    Bitboard* next = &workspace.layers[1];
+    Bitboard& visited = workspace.reached;
+    frontier->set(src.row, src.column);
+    visited.set(src.row, src.column);
+
+    // Filas que contienen la frontera actual
+    int firstRow = src.row;
+    int lastRow = src.row;
+
+    for (int step = 1; ; ++step) {
+        int newFirstRow;
+        int newLastRow;
+        const int scanFirst = std::max(0, firstRow - 1);
+        const int scanLast = std::min(rows - 1, lastRow + 1);
+        workspace.touchRows(scanFirst, scanLast);
+        expandLayer(*frontier, walkable, blocked, visited, *next, scanFirst, scanLast, step, distances,
+                    newFirstRow, newLastRow);
+        if (newLastRow == -1) {
+            return -1;
+        }
+        if (goalId != -1 && distances[goalId] == step) {
+            return step;
+        }
+
+        // La capa anterior se reutiliza como siguiente: limpiar sus filas que el próximo paso no reescribirá
+        std::swap(frontier, next);
+        for (int r = firstRow; r <= lastRow; ++r) {
+            if (r >= newFirstRow - 1 && r <= newLastRow + 1) {
+                continue;
+            }
+            Bitboard::Word* rowWords = next->row(r);
+            for (int w = 0; w < next->getWordsPerRow(); ++w) {
+                rowWords[w] = 0;
+            }
+        }
 
-    DynamicArray<int> parent(graph.getRows() * graph.getCols());
-    for (int i = 0; i < parent.size(); ++i) {
-        parent[i] = -1;
+        firstRow = newFirstRow;
+        lastRow = newLastRow;
     }
+}
 
-    Queue<int> q;
-    int startId = graph.toIndex(src.row, src.column);
-    int goalId = graph.toIndex(dest.row, dest.column);
+/**
+ * @brief BFS bit-paralela: expande una capa completa por paso con desplazamientos y máscaras de palabras.
+ *
+ * Produce caminos de la misma longitud que bfs(); el camino se reconstruye retrocediendo desde el destino
+ * por vecinos de la capa anterior.
+ *
+ * @param src Posición de inicio.
+ * @param dest Posición de destino.
+ * @return Camino desde el inicio hasta el destino, vacío si no existe.
+ */
+Path Pathfinder::bitParallelBfs(const Position src, const Position dest, const Bitboard* blocked) {
+    const int startId = graph.toIndex(src.row, src.column);
+    const int goalId = graph.toIndex(dest.row, dest.column);
 
-    // Iniciar BFS desde el nodo inicial.
-    visited[startId] = true;
-    q.push(startId);
+    // Si los nodos están en componentes distintas no hay camino: evitar inundar el mapa
+    if (startId != goalId && (!graph.areConnected(startId, goalId) || isMasked(blocked, goalId, graph.getCols()))) {
+        return {};
+    }
 
-    while (!q.empty()) {
-        int current = q.front();
-        q.pop();
+    const int length = computeBitLayers(src, goalId, blocked);
+    if (length == -1) {
+        return {};
+    }
 
-        // Si llegamos al nodo objetivo, reconstruir el camino.
-        if (current == goalId) {
-            auto* path = new LinkedList<Position>();
-            for (int at = goalId; at != -1; at = parent[at]) {
-                path->insertAt(0, Position{at / graph.getCols(), at % graph.getCols()});
+    // Retroceder capa a capa desde el destino, rellenando el camino desde el final
+    const DynamicArray<int>& distances = workspace.layerDistance;
+    Path path(length + 1);
+    int current = goalId;
+    path[length] = dest;
+    for (int step = length - 1; step >= 0; --step) {
+        const unsigned char mask = graph.getNeighborMask(current);
+        for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+            if (mask & (1 << direction)) {
+                const int neighbor = graph.getNeighborId(current, direction);
+                if (distances[neighbor] == step) {
+                    current = neighbor;
+                    break;
+                }
             }
-            return path;
         }
+        path[step] = Position{current / graph.getCols(), current % graph.getCols()};
+    }
 
-        // Explorar los nodos vecinos
-        const LinkedList<int>& neighbors = graph.getAdjList()[current];
-        for (int i = 0; i < neighbors.size(); ++i) {
-            int neighbor = neighbors[i];
-            if (!visited[neighbor]) {
-                visited[neighbor] = true;
-                parent[neighbor] = current;
-                q.push(neighbor);
+    return path;
+}
+
+/**
+ * @brief Calcula con BFS bit-paralela la distancia desde un origen a todas las celdas.
+ *
+ * @param src Posición de origen.
+ * @param distances Arreglo de salida (filas x columnas) con -1 en las celdas inalcanzables.
+ */
+void Pathfinder::bitParallelDistances(const Position src, DynamicArray<int>& distances, const Bitboard* blocked) {
+    computeBitLayers(src, -1, blocked);
+
+    // El campo completo es la salida: se copia el arreglo del espacio de trabajo, que sigue limpio por filas
+    const DynamicArray<int>& layerDistance = workspace.layerDistance;
+    distances.resize(layerDistance.size());
+    for (int i = 0; i < layerDistance.size(); ++i) {
+        distances[i] = layerDistance[i];
+    }
+}
+
+/**
+ * @brief BFS multi-origen compartida por distanceField() y flowField().
+ *
+ * Todas las fuentes accesibles entran en la cola con distancia 0. Si directions no es nulo, cada celda
+ * descubierta guarda la dirección opuesta a la del paso que la alcanzó (direction ^ 1 en el orden
+ * arriba, abajo, izquierda, derecha), que apunta a su padre y por tanto hacia la fuente más cercana.
+ *
+ * @param graph Mapa sobre el que se busca.
+ * @param queue Cola de trabajo de filas x columnas posiciones.
+ * @param sources Posiciones de las fuentes.
+ * @param distances Arreglo de salida con -1 en las celdas inalcanzables.
+ * @param directions Arreglo de salida de direcciones, o nullptr.
+ * @param blocked Máscara de bloqueo, o nullptr; se prueba al descubrir cada celda para que las bloqueadas queden en -1.
+ */
+static void multiSourceBfs(const GridGraph& graph, DynamicArray<int>& queue, const DynamicArray<Position>& sources,
+                           DynamicArray<int>& distances, DynamicArray<unsigned char>* directions, const Bitboard* blocked) {
+    const int nodeCount = graph.getRows() * graph.getCols();
+    distances.resize(nodeCount);
+    for (int i = 0; i < nodeCount; ++i) {
+        distances[i] = -1;
+    }
+    if (directions) {
+        directions->resize(nodeCount);
+        for (int i = 0; i < nodeCount; ++i) {
+            (*directions)[i] = Pathfinder::NO_DIRECTION;
+        }
+    }
+
+    int head = 0;
+    int tail = 0;
+    for (int i = 0; i < sources.size(); ++i) {
+        const int id = graph.toIndex(sources[i].row, sources[i].column);
+        if (distances[id] == -1 && !graph.isObstacle(sources[i].row, sources[i].column)) {
+            distances[id] = 0;
+            if (directions) {
+                (*directions)[id] = Pathfinder::FLOW_TARGET;
             }
+            queue[tail++] = id;
         }
     }
 
-    // Si no se encuentra un camino, devolver un vector vacío.
-    return nullptr;
+    while (head < tail) {
+        const int current = queue[head++];
+        const int nextDistance = distances[current] + 1;
+        const unsigned char mask = graph.getNeighborMask(current);
+        for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+            if (!(mask & (1 << direction))) {
+                continue;
+            }
+            const int neighbor = graph.getNeighborId(current, direction);
+            if (distances[neighbor] == -1 && !isMasked(blocked, neighbor, graph.getCols())) {
+                distances[neighbor] = nextDistance;
+                if (directions) {
+                    (*directions)[neighbor] = static_cast<unsigned char>(direction ^ 1);
+                }
+                queue[tail++] = neighbor;
+            }
+        }
+    }
+}
+
+void Pathfinder::distanceField(const DynamicArray<Position>& sources, DynamicArray<int>& distances,
+                               const Bitboard* blocked) {
+    workspace.begin(graph.getRows() * graph.getCols());
+    multiSourceBfs(graph, workspace.queue, sources, distances, nullptr, blocked);
+}
+
+void Pathfinder::flowField(const DynamicArray<Position>& targets, DynamicArray<int>& distances,
+                           DynamicArray<unsigned char>& directions, const Bitboard* blocked) {
+    workspace.begin(graph.getRows() * graph.getCols());
+    multiSourceBfs(graph, workspace.queue, targets, distances, &directions, blocked);
 }
 
 /**
- * @brief Implementación del algoritmo de Dijkstra para encontrar el camino más corto desde un nodo de inicio a un nodo de destino.
- * @param startId Identificador del nodo de inicio.
- * @param goalId Identificador del nodo objetivo.
- * @return Un vector con los nodos que forman el camino más corto desde el inicio hasta el objetivo.
+ * @brief Sigue un campo de flujo desde una celda hasta el objetivo más cercano.
+ *
+ * Cada dirección lleva a una celda un paso más cerca de un objetivo, así que el recorrido termina en
+ * uno de ellos tras tantos pasos como su distancia, sin búsqueda.
  */
-LinkedList<Position>* Pathfinder::dijkstra(Position src, Position dest) {
-    const int INF = std::numeric_limits<int>::max(); // Valor infinito para inicializar distancias.
-    DynamicArray<int> dist(graph.getRows() * graph.getCols());
-    for (int i = 0; i < dist.size(); ++i) {
-        dist[i] = INF;
+Path Pathfinder::followFlowField(const Position src, const DynamicArray<unsigned char>& directions) const {
+    int current = graph.toIndex(src.row, src.column);
+    if (directions[current] == NO_DIRECTION) {
+        return {};
     }
 
-    DynamicArray<int> parent(graph.getRows() * graph.getCols());
-    for (int i = 0; i < parent.size(); ++i) {
-        parent[i] = -1;
+    Path path;
+    path.push_back(src);
+    for (unsigned char direction = directions[current]; direction != FLOW_TARGET; direction = directions[current]) {
+        current = graph.getNeighborId(current, direction);
+        path.push_back(Position{current / graph.getCols(), current % graph.getCols()});
     }
+    return path;
+}
+
+/**
+ * @brief Implementación del algoritmo de Dijkstra para encontrar el camino más corto desde un nodo de inicio a un nodo de destino.
+ * @param src Posición de inicio.
+ * @param dest Posición de destino.
+ * @return true si se alcanzó el destino; los padres quedan en el espacio de trabajo.
+ */
+bool Pathfinder::searchDijkstra(const Position src, const Position dest, const Bitboard* blocked) {
     int startId = graph.toIndex(src.row, src.column);
     int goalId = graph.toIndex(dest.row, dest.column);
 
-    dist[startId] = 0;
+    // Si los nodos están en componentes distintas no hay camino: evitar inundar el mapa
+    if (startId != goalId && (!graph.areConnected(startId, goalId) || isMasked(blocked, goalId, graph.getCols()))) {
+        return false;
+    }
+
+    // Las distancias no escritas en esta búsqueda valen SearchWorkspace::INF
+    workspace.begin(graph.getRows() * graph.getCols());
+    workspace.visit(startId, -1, 0);
 
     // Cola de prioridad que almacena pares (distancia, nodo).
-    PriorityQueue<Pair<int, int>> pq;
+    PriorityQueue<Pair<int, int>>& pq = workspace.heap;
     pq.push(Pair<int, int>(0, startId));
+    expandedNodes = 0;
 
     while (!pq.empty()) {
         int currentDist = pq.top().first;
         int current = pq.top().second;
         pq.pop();
+        if (current != startId && isMasked(blocked, current, graph.getCols())) {
+            continue;
+        }
+        ++expandedNodes;
 
-        // Si llegamos al nodo objetivo, reconstruir el camino.
+        // Si llegamos al nodo objetivo, los padres quedan listos para reconstruir el camino.
         if (current == goalId) {
-            auto* path = new LinkedList<Position>();
-            for (int at = goalId; at != -1; at = parent[at]) {
-                path->insertAt(0, Position{at / graph.getCols(), at % graph.getCols()});
-            }
-            return path;
+            return true;
         }
 
         // Si la distancia actual es mayor que la mejor conocida, omitir.
-        if (currentDist > dist[current]) continue;
+        if (currentDist > workspace.getDistance(current)) continue;
 
         // Explorar los nodos vecinos
-        const LinkedList<int>& neighbors = graph.getAdjList()[current];
-        for (int i = 0; i < neighbors.size(); ++i) {
-            int neighbor = neighbors[i];
+        const unsigned char mask = graph.getNeighborMask(current);
+        for (int direction = 0; direction < GridGraph::NEIGHBOR_COUNT; ++direction) {
+            if (!(mask & (1 << direction))) {
+                continue;
+            }
+            int neighbor = graph.getNeighborId(current, direction);
             // Suponemos un peso de 1 para cada arista
-            int newDist = dist[current] + 1;
+            int newDist = currentDist + 1;
 
-            if (newDist < dist[neighbor]) {
-                dist[neighbor] = newDist;
-                parent[neighbor] = current;
+            if (newDist < workspace.getDistance(neighbor)) {
+                workspace.visit(neighbor, current, newDist);
                 pq.push({newDist, neighbor});
             }
         }
     }
 
-    // Si no se encuentra un camino, devolver un vector vacío.
-    return nullptr;
+    return false;
 }
 
-LinkedList<Position>* Pathfinder::lineaVista(Position start, Position goal) const {
+Path Pathfinder::dijkstra(const Position src, const Position dest, const Bitboard* blocked) {
+    Path path;
+    if (searchDijkstra(src, dest, blocked)) {
+        appendBuiltPath(workspace, graph.getCols(), graph.toIndex(dest.row, dest.column), path);
+    }
+    return path;
+}
+
+Path Pathfinder::lineaVista(Position start, Position goal) const {
     auto [startRow, startCol] = start;
     auto [goalRow, goalCol] = goal;
 
-    auto* path = new Queue<Position>();
+    Path path;
 
     if (startRow == goalRow) { // Move horizontally
         const int colIncrement = goalCol > startCol ? 1 : -1;
         for (int col = startCol + colIncrement; col != goalCol + colIncrement; col += colIncrement) {
-            if (GridGraph::isValid(startRow, col) && graph.isObstacle(startRow, col)) {
-                return convertQueueToLinkedList(path);
+            if (graph.isValid(startRow, col) && graph.isObstacle(startRow, col)) {
+                return path;
             }
-            path->push(Position{startRow, col});
+            path.push_back(Position{startRow, col});
         }
-        return convertQueueToLinkedList(path);
+        return path;
     }
     if (startCol == goalCol) { // Move vertically
         const int rowIncrement = goalRow > startRow ? 1 : -1;
         for (int row = startRow + rowIncrement; row != goalRow + rowIncrement; row += rowIncrement) {
-            if (GridGraph::isValid(row, startCol) && graph.isObstacle(row, startCol)) {
-                return convertQueueToLinkedList(path);
+            if (graph.isValid(row, startCol) && graph.isObstacle(row, startCol)) {
+                return path;
             }
-            path->push(Position{row, startCol});
+            path.push_back(Position{row, startCol});
         }
-        return convertQueueToLinkedList(path);
+        return path;
     }
 
-    return nullptr;
+    return path;
 }
 
 /**
@@ -219,12 +609,12 @@ LinkedList<Position>* Pathfinder::lineaVista(Position start, Position goal) cons
  * @param goalId Identificador del nodo objetivo.
  * @return Un vector con los nodos que forman el camino desde el inicio hasta el objetivo.
  */
-LinkedList<Position>* Pathfinder::randomMovement(Position src, Position dest) {
+Path Pathfinder::randomMovement(Position src, Position dest) {
     const int startId = graph.toIndex(src.row, src.column);
     const int goalId = graph.toIndex(dest.row, dest.column);
 
     int currentId = startId;
-    auto* totalPath = new LinkedList<Position>();
+    Path totalPath;
     int attempts = 0;
 
     while (attempts < 4) {
@@ -237,24 +627,19 @@ LinkedList<Position>* Pathfinder::randomMovement(Position src, Position dest) {
         const Position currentPos{currentRow, currentCol};
         const Position goalPos{goalRow, goalCol};
 
-        LinkedList<Position>* lineaVistaPath = lineaVista(currentPos, goalPos);
-        if (lineaVistaPath != nullptr && !lineaVistaPath->empty()) {
+        const Path lineaVistaPath = lineaVista(currentPos, goalPos);
+        if (!lineaVistaPath.empty()) {
             // Se encontró línea de vista directa
             // Evitar duplicar el nodo actual si ya está en totalPath
-            if (!totalPath->empty() && totalPath->at(totalPath->size() - 1) == lineaVistaPath->at(0)) {
-                lineaVistaPath->removeAt(0);
+            int first = 0;
+            if (!totalPath.empty() && totalPath.back() == lineaVistaPath.at(0)) {
+                first = 1;
             }
-            for (int i = 0; i < lineaVistaPath->size(); ++i) {
-                totalPath->append(lineaVistaPath->at(i));
+            for (int i = first; i < lineaVistaPath.size(); ++i) {
+                totalPath.push_back(lineaVistaPath.at(i));
             }
-            delete lineaVistaPath; // Liberar memoria
-            if (!totalPath->empty()) {
-                return totalPath;
-            }
-            delete totalPath;
-            return nullptr;
+            return totalPath;
         }
-        delete lineaVistaPath; // Liberar memoria si no se usó
 
         // No hay línea de vista, realizar movimiento aleatorio
         DynamicArray<int> randomPath;
@@ -310,12 +695,13 @@ LinkedList<Position>* Pathfinder::randomMovement(Position src, Position dest) {
         // Agregar el camino aleatorio al camino total
         if (!randomPath.empty()) {
             // Evitar duplicar el nodo actual si ya está en totalPath
-            if (!totalPath->empty() && totalPath->at(totalPath->size() - 1) == Position{randomPath[0] / graph.getCols(), randomPath[0] % graph.getCols()}) {
-                randomPath.removeAt(0);
+            int first = 0;
+            if (!totalPath.empty() && totalPath.back() == Position{randomPath[0] / graph.getCols(), randomPath[0] % graph.getCols()}) {
+                first = 1;
             }
 
-            for (int i = 0; i < randomPath.size(); ++i) {
-                totalPath->append(Position{randomPath[i] / graph.getCols(), randomPath[i] % graph.getCols()});
+            for (int i = first; i < randomPath.size(); ++i) {
+                totalPath.push_back(Position{randomPath[i] / graph.getCols(), randomPath[i] % graph.getCols()});
             }
 
             // Actualizar currentId al último nodo del camino aleatorio
@@ -328,638 +714,578 @@ LinkedList<Position>* Pathfinder::randomMovement(Position src, Position dest) {
         attempts++;
     }
 
-    if (!totalPath->empty()) {
-        return totalPath;
-    }
-    delete totalPath;
-    return nullptr;
+    return totalPath;
 }
 
-typedef std::pair<int, int> IntPair;
-typedef std::pair<double, std::pair<int, int> > pPair;
+/**
+ * @brief Reconstruye un camino de costes no uniformes siguiendo los padres, sin incluir el origen, y lo añade a path.
+ *
+ * Cuenta primero los pasos y luego rellena el camino desde el final, en orden de recorrido.
+ *
+ * @param workspace Espacio de trabajo de la búsqueda que alcanzó el destino.
+ * @param cols Número de columnas de la cuadrícula.
+ * @param goalId ID del nodo de destino.
+ * @param path Camino al que se añaden las posiciones desde el paso siguiente al origen hasta el destino.
+ */
+static void appendTracedParents(const SearchWorkspace& workspace, const int cols, const int goalId, Path& path) {
+    int length = 0;
+    for (int at = goalId; workspace.getParent(at) != -1; at = workspace.getParent(at)) {
+        ++length;
+    }
 
-bool isDestination(const int row, const int col, const IntPair &dest) {
-    return row == dest.first && col == dest.second;
+    const int start = path.size();
+    path.resize(start + length);
+    int at = goalId;
+    for (int index = start + length - 1; index >= start; --index) {
+        path[index] = Position{at / cols, at % cols};
+        at = workspace.getParent(at);
+    }
 }
 
-double calculateHValue(const int row, const int col, const Position &dest) {
-    return sqrt((row - dest.row) * (row - dest.row) + (col - dest.column) * (col - dest.column));
+/**
+ * @brief Distancia octil entre dos celdas con los costes de Pathfinder::STRAIGHT_COST y DIAGONAL_COST.
+ *
+ * Es la longitud exacta del camino 8-conexo sin obstáculos, así que la heurística es admisible y consistente.
+ */
+static int octileDistance(const int row, const int col, const Position& dest) {
+    const int dRow = abs(row - dest.row);
+    const int dCol = abs(col - dest.column);
+    const int diagonal = min(dRow, dCol);
+    return Pathfinder::STRAIGHT_COST * (dRow + dCol - 2 * diagonal) + Pathfinder::DIAGONAL_COST * diagonal;
 }
 
-bool isDestination(int row, int col, Position dest)
-{
-    if (row == dest.row && col == dest.column)
-        return (true);
-    return (false);
+/**
+ * @brief Prioridad de A* para el montículo: f en la parte alta y h en la baja.
+ *
+ * Entre nodos con igual f sale antes el de menor h (el más cercano al destino), lo que evita expandir
+ * las franjas de caminos equivalentes.
+ */
+static long long aStarKey(const int g, const int h) {
+    return (static_cast<long long>(g + h) << 32) | h;
 }
 
-bool isValid(int row, int col)
-{
-    // Returns true if row number and column number
-    // is in range
-    return (row >= 0) && (row < ROW) && (col >= 0)
-           && (col < COL);
-}
+/**
+ * @brief A* 8-conexo con heurística octil sobre un montículo indexado con disminución de clave.
+ *
+ * Los costes son enteros (ortogonal 70, diagonal 99 ~ 70 * sqrt(2)) y los padres, costes y posiciones en
+ * el montículo viven en el espacio de trabajo reutilizado, así que una consulta no reserva memoria.
+ * Como en la versión anterior, los movimientos diagonales pueden pasar entre dos obstáculos en esquina.
+ *
+ * @param src Posición de inicio.
+ * @param dest Posición de destino.
+ * @return true si se alcanzó el destino; los padres quedan en el espacio de trabajo.
+ */
+bool Pathfinder::searchAStar(const Position src, const Position dest, const Bitboard* blocked) {
+    if (!graph.isValid(src.row, src.column) || !graph.isValid(dest.row, dest.column)
+        || graph.isObstacle(src.row, src.column) || graph.isObstacle(dest.row, dest.column) || src == dest) {
+        return false;
+    }
+
+    const int cols = graph.getCols();
+    const int startId = graph.toIndex(src.row, src.column);
+    const int goalId = graph.toIndex(dest.row, dest.column);
+    if (isMasked(blocked, goalId, cols)) {
+        return false;
+    }
+
+    workspace.begin(graph.getRows() * cols);
+    IndexedPriorityQueue<long long>& open = workspace.open;
+    workspace.visit(startId, -1, 0);
+    open.pushOrDecrease(startId, aStarKey(0, octileDistance(src.row, src.column, dest)));
+
+    expandedNodes = 0;
+    while (!open.empty()) {
+        const int id = open.pop();
+        if (id != startId && isMasked(blocked, id, cols)) {
+            continue;
+        }
+        ++expandedNodes;
+        if (id == goalId) {
+            return true;
+        }
 
-LinkedList<Position>* tracePath(cell cellDetails[][COL], const Position dest) {
-    auto [row, col] = dest;
+        const int row = id / cols;
+        const int col = id % cols;
+        const int g = workspace.getDistance(id);
 
-    auto* path = new Stack<Position>();
+        for (int direction = 0; direction < OCTILE_COUNT; ++direction) {
+            const int nextRow = row + OCTILE_ROW_OFFSETS[direction];
+            const int nextCol = col + OCTILE_COL_OFFSETS[direction];
+            if (!graph.isValid(nextRow, nextCol) || graph.isObstacle(nextRow, nextCol)) {
+                continue;
+            }
 
-    while (!(cellDetails[row][col].parent_i == row
-            && cellDetails[row][col].parent_j == col)) {
-        path->push(Position{row, col});
-        const int temp_row = cellDetails[row][col].parent_i;
-        const int temp_col = cellDetails[row][col].parent_j;
-        row = temp_row;
-        col = temp_col;
+            // Con una heurística consistente un nodo cerrado nunca mejora, así que basta comparar costes
+            const int nextId = id + OCTILE_ROW_OFFSETS[direction] * cols + OCTILE_COL_OFFSETS[direction];
+            const int nextG = g + (direction < 4 ? STRAIGHT_COST : DIAGONAL_COST);
+            if (nextG < workspace.getDistance(nextId)) {
+                workspace.visit(nextId, id, nextG);
+                open.pushOrDecrease(nextId, aStarKey(nextG, octileDistance(nextRow, nextCol, dest)));
+            }
+        }
     }
 
-    return convertStackToLinkedList(*path);
+    return false;
 }
 
-LinkedList<Position> *Pathfinder::aStar(const Position src, const Position dest) const {
-    if (!GridGraph::isValid(src.row, src.column)) {
-        printf("Start node is invalid\n");
-        return nullptr;
+Path Pathfinder::aStar(const Position src, const Position dest, const Bitboard* blocked) {
+    Path path;
+    if (searchAStar(src, dest, blocked)) {
+        appendTracedParents(workspace, graph.getCols(), graph.toIndex(dest.row, dest.column), path);
     }
+    return path;
+}
 
-    if (!GridGraph::isValid(dest.row, dest.column)) {
-        printf("Goal node is invalid\n");
-        return nullptr;
-    }
+/**
+ * @brief Verifica si una celda está dentro del mapa, no es un obstáculo y no está en la máscara de bloqueo.
+ */
+static bool isOpen(const GridGraph& graph, const Bitboard* blocked, const int row, const int col) {
+    return graph.isValid(row, col) && !graph.isObstacle(row, col) && !(blocked && blocked->test(row, col));
+}
 
-    if (graph.isObstacle(src.row, src.column)
-        || graph.isObstacle(dest.row, dest.column)) {
-        printf("Start node is an obstacle\n");
-        return nullptr;
+/**
+ * @brief Reconstruye celda a celda un camino de Jump Point Search y lo añade a path.
+ *
+ * Los padres del espacio de trabajo son puntos de salto; entre dos consecutivos el camino es un
+ * segmento recto o diagonal puro, así que basta con interpolar paso a paso.
+ *
+ * @param workspace Espacio de trabajo de la búsqueda que alcanzó el destino.
+ * @param cols Número de columnas de la cuadrícula.
+ * @param goalId ID del nodo de destino.
+ * @param includeSource true para que el camino empiece en el origen.
+ * @param path Camino al que se añaden las posiciones en orden de recorrido.
+ */
+static void appendJumpPath(const SearchWorkspace& workspace, const int cols, const int goalId,
+                           const bool includeSource, Path& path) {
+    // Cada segmento aporta max(|dRow|, |dCol|) celdas
+    int length = includeSource ? 1 : 0;
+    for (int at = goalId, parent; (parent = workspace.getParent(at)) != -1; at = parent) {
+        length += max(abs(at / cols - parent / cols), abs(at % cols - parent % cols));
     }
 
-    if (src == dest) {
-        printf("Source node is the destination node\n");
-        return nullptr;
+    const int start = path.size();
+    path.resize(start + length);
+    int index = start + length - 1;
+    int at = goalId;
+    for (int parent; (parent = workspace.getParent(at)) != -1; at = parent) {
+        const int stepRow = (parent / cols > at / cols) - (parent / cols < at / cols);
+        const int stepCol = (parent % cols > at % cols) - (parent % cols < at % cols);
+        for (int row = at / cols, col = at % cols; row != parent / cols || col != parent % cols;
+             row += stepRow, col += stepCol) {
+            path[index--] = Position{row, col};
+        }
     }
+    if (includeSource) {
+        path[start] = Position{at / cols, at % cols};
+    }
+}
 
-    bool closedList[ROW][COL];
-    memset(closedList, false, sizeof(closedList));
-
-    // Declare a 2D array of structure to hold the details
-    // of that cell
-    cell cellDetails[ROW][COL];
-
-    int i, j;
+/**
+ * @brief Avance horizontal de Jump Point Search resuelto de 64 en 64 columnas sobre el plano de bits.
+ *
+ * Por cada ventana calcula a la vez las celdas libres de la fila y los vecinos forzados de las filas
+ * contiguas; el primer punto de salto es el bit más cercano anterior al primer obstáculo.
+ *
+ * @param row Fila del avance.
+ * @param col Columna de partida (excluida).
+ * @param dCol Sentido del avance (1 o -1).
+ * @param goalId ID del nodo objetivo.
+ * @param diagonal true para 8-conectividad, false para 4-conectividad.
+ * @param blocked Máscara de bloqueo, o nullptr; sus celdas cuentan como obstáculos.
+ * @return ID del punto de salto, o -1 si el avance choca con un obstáculo o el borde.
+ */
+static int scanRow(const GridGraph& graph, const int row, const int col, const int dCol, const int goalId,
+                   const bool diagonal, const Bitboard* blocked) {
+    using Word = Bitboard::Word;
+    const Bitboard& walkable = graph.getWalkableBoard();
+    auto open = [&](const int r, const int start) {
+        return blocked ? walkable.extract(r, start) & ~blocked->extract(r, start) : walkable.extract(r, start);
+    };
+    const int goalCol = goalId / graph.getCols() == row ? goalId % graph.getCols() : -Bitboard::WORD_BITS - 1;
+
+    // En 8-conectividad el vecino forzado está una columna por delante; en 4-conectividad, en la misma columna
+    const int ahead = diagonal ? dCol : 0;
+    const int behind = diagonal ? 0 : -dCol;
+    auto events = [&](const int start) {
+        Word result = 0;
+        for (const int side : {row - 1, row + 1}) {
+            if (side >= 0 && side < graph.getRows()) {
+                result |= open(side, start + ahead) & ~open(side, start + behind);
+            }
+        }
+        if (goalCol >= start && goalCol < start + Bitboard::WORD_BITS) {
+            result |= Word(1) << (goalCol - start);
+        }
+        return result;
+    };
+
+    if (dCol > 0) {
+        for (int start = col + 1; ; start += Bitboard::WORD_BITS) {
+            const int firstBlocked = std::countr_zero(~open(row, start));
+            const Word reachable = firstBlocked == Bitboard::WORD_BITS ? ~Word(0) : (Word(1) << firstBlocked) - 1;
+            if (const Word candidates = events(start) & reachable) {
+                return graph.toIndex(row, start + std::countr_zero(candidates));
+            }
+            if (firstBlocked < Bitboard::WORD_BITS) {
+                return -1;
+            }
+        }
+    }
 
-    for (i = 0; i < ROW; i++) {
-        for (j = 0; j < COL; j++) {
-            cellDetails[i][j].f = FLT_MAX;
-            cellDetails[i][j].g = FLT_MAX;
-            cellDetails[i][j].h = FLT_MAX;
-            cellDetails[i][j].parent_i = -1;
-            cellDetails[i][j].parent_j = -1;
+    // Hacia la izquierda la ventana termina en la columna anterior y se recorre desde el bit más alto
+    for (int start = col - Bitboard::WORD_BITS; ; start -= Bitboard::WORD_BITS) {
+        const int firstBlocked = std::countl_zero(~open(row, start));
+        const Word reachable = firstBlocked == 0 ? 0 : ~Word(0) << (Bitboard::WORD_BITS - firstBlocked);
+        if (const Word candidates = events(start) & reachable) {
+            return graph.toIndex(row, start + Bitboard::WORD_BITS - 1 - std::countl_zero(candidates));
+        }
+        if (firstBlocked < Bitboard::WORD_BITS) {
+            return -1;
         }
     }
+}
 
-    // Initialising the parameters of the starting node
-    i = src.row, j = src.column;
-    cellDetails[i][j].f = 0.0;
-    cellDetails[i][j].g = 0.0;
-    cellDetails[i][j].h = 0.0;
-    cellDetails[i][j].parent_i = i;
-    cellDetails[i][j].parent_j = j;
+Path Pathfinder::findPath(const PathAlgorithm algorithm, const Position src, const Position dest,
+                          const Bitboard* blocked) {
+    Path path;
+    appendPath(algorithm, src, dest, path, blocked);
+    return path;
+}
 
-    /*
-     Create an open list having information as-
-     <f, <i, j>>
-     where f = g + h,
-     and i, j are the row and column index of that cell
-     Note that 0 <= i <= ROW-1 & 0 <= j <= COL-1
-     This open list is implemented as a set of pair of
-     pair.*/
-    set<pPair> openList;
-
-    // Put the starting cell on the open list and set its
-    // 'f' as 0
-    openList.insert(make_pair(0.0, make_pair(i, j)));
-
-    // We set this boolean value as false as initially
-    // the destination is not reached.
-    bool foundDest = false;
-
-    while (!openList.empty()) {
-        pPair p = *openList.begin();
-
-        // Remove this vertex from the open list
-        openList.erase(openList.begin());
-
-        // Add this vertex to the closed list
-        i = p.second.first;
-        j = p.second.second;
-        closedList[i][j] = true;
-
-        /*
-         Generating all the 8 successor of this cell
-
-             N.W   N   N.E
-               \   |   /
-                \  |  /
-             W----Cell----E
-                  / | \
-                /   |  \
-             S.W    S   S.E
-
-         Cell-->Popped Cell (i, j)
-         N -->  North       (i-1, j)
-         S -->  South       (i+1, j)
-         E -->  East        (i, j+1)
-         W -->  West           (i, j-1)
-         N.E--> North-East  (i-1, j+1)
-         N.W--> North-West  (i-1, j-1)
-         S.E--> South-East  (i+1, j+1)
-         S.W--> South-West  (i+1, j-1)*/
-
-        // To store the 'g', 'h' and 'f' of the 8 successors
-        double gNew, hNew, fNew;
-
-        //----------- 1st Successor (North) ------------
-
-        // Only process this cell if this is a valid one
-        if (GridGraph::isValid(i - 1, j) == true) {
-            // If the destination cell is the same as the
-            // current successor
-            if (isDestination(i - 1, j, dest) == true) {
-                // Set the Parent of the destination cell
-                cellDetails[i - 1][j].parent_i = i;
-                cellDetails[i - 1][j].parent_j = j;
-                printf("The destination cell is found\n");
-                foundDest = true;
-                return tracePath(cellDetails, dest);
-            }
-            // If the successor is already on the closed
-            // list or if it is blocked, then ignore it.
-            // Else do the following
-            else if (closedList[i - 1][j] == false
-                     && !graph.isObstacle(i - 1, j)) {
-                gNew = cellDetails[i][j].g + 1.0;
-                hNew = calculateHValue(i - 1, j, dest);
-                fNew = gNew + hNew;
-
-                // If it isn’t on the open list, add it to
-                // the open list. Make the current square
-                // the parent of this square. Record the
-                // f, g, and h costs of the square cell
-                //                OR
-                // If it is on the open list already, check
-                // to see if this path to that square is
-                // better, using 'f' cost as the measure.
-                if (cellDetails[i - 1][j].f == FLT_MAX
-                    || cellDetails[i - 1][j].f > fNew) {
-                    openList.insert(make_pair(
-                        fNew, make_pair(i - 1, j)));
-
-                    // Update the details of this cell
-                    cellDetails[i - 1][j].f = fNew;
-                    cellDetails[i - 1][j].g = gNew;
-                    cellDetails[i - 1][j].h = hNew;
-                    cellDetails[i - 1][j].parent_i = i;
-                    cellDetails[i - 1][j].parent_j = j;
-                }
+int Pathfinder::appendPath(const PathAlgorithm algorithm, const Position src, const Position dest, Path& path,
+                           const Bitboard* blocked) {
+    const int start = path.size();
+    const int cols = graph.getCols();
+    const int goalId = graph.toIndex(dest.row, dest.column);
+    switch (algorithm) {
+        case PathAlgorithm::Dijkstra:
+            if (searchDijkstra(src, dest, blocked)) {
+                appendBuiltPath(workspace, cols, goalId, path);
             }
-        }
-
-        //----------- 2nd Successor (South) ------------
-
-        // Only process this cell if this is a valid one
-        if (isValid(i + 1, j) == true) {
-            // If the destination cell is the same as the
-            // current successor
-            if (isDestination(i + 1, j, dest) == true) {
-                // Set the Parent of the destination cell
-                cellDetails[i + 1][j].parent_i = i;
-                cellDetails[i + 1][j].parent_j = j;
-                printf("The destination cell is found\n");
-                return tracePath(cellDetails, dest);
-                foundDest = true;
-            }
-            // If the successor is already on the closed
-            // list or if it is blocked, then ignore it.
-            // Else do the following
-            else if (closedList[i + 1][j] == false
-                     && !graph.isObstacle(i + 1, j)) {
-                gNew = cellDetails[i][j].g + 1.0;
-                hNew = calculateHValue(i + 1, j, dest);
-                fNew = gNew + hNew;
-
-                // If it isn’t on the open list, add it to
-                // the open list. Make the current square
-                // the parent of this square. Record the
-                // f, g, and h costs of the square cell
-                //                OR
-                // If it is on the open list already, check
-                // to see if this path to that square is
-                // better, using 'f' cost as the measure.
-                if (cellDetails[i + 1][j].f == FLT_MAX
-                    || cellDetails[i + 1][j].f > fNew) {
-                    openList.insert(make_pair(
-                        fNew, make_pair(i + 1, j)));
-                    // Update the details of this cell
-                    cellDetails[i + 1][j].f = fNew;
-                    cellDetails[i + 1][j].g = gNew;
-                    cellDetails[i + 1][j].h = hNew;
-                    cellDetails[i + 1][j].parent_i = i;
-                    cellDetails[i + 1][j].parent_j = j;
-                }
+            break;
+        case PathAlgorithm::AStar:
+            if (searchAStar(src, dest, blocked)) {
+                appendTracedParents(workspace, cols, goalId, path);
             }
+            break;
+        case PathAlgorithm::JumpPointDiagonal:
+            if (searchJumpPointsDiagonal(src, dest, blocked)) {
+                appendJumpPath(workspace, cols, goalId, false, path);
+            }
+            break;
+        case PathAlgorithm::Bfs:
+        default:
+            if (searchBfs(src, dest, blocked)) {
+                appendBuiltPath(workspace, cols, goalId, path);
+            }
+            break;
+    }
+    return path.size() - start;
+}
+
+int Pathfinder::getExpandedNodeCount() const {
+    return expandedNodes;
+}
+
+/**
+ * @brief Avanza desde una celda en una dirección hasta el siguiente punto de salto.
+ *
+ * Una celda es punto de salto si es el objetivo, si tiene un vecino forzado (una celda libre a la que
+ * solo se llega de forma óptima pasando por ella) o, en los avances que ramifican, si alguno de los
+ * avances rectos que parten de ella encuentra un punto de salto. En 8-conectividad ramifican las
+ * diagonales; en 4-conectividad los avances verticales ramifican en horizontal.
+ */
+int Pathfinder::jump(int row, int col, const int dRow, const int dCol, const int goalId, const bool diagonal) const {
+    if (dRow == 0) {
+        return scanRow(graph, row, col, dCol, goalId, diagonal, blockingMask);
+    }
+
+    while (true) {
+        row += dRow;
+        col += dCol;
+        if (!isOpen(graph, blockingMask, row, col)) {
+            return -1;
         }
 
-        //----------- 3rd Successor (East) ------------
-
-        // Only process this cell if this is a valid one
-        if (isValid(i, j + 1) == true) {
-            // If the destination cell is the same as the
-            // current successor
-            if (isDestination(i, j + 1, dest) == true) {
-                // Set the Parent of the destination cell
-                cellDetails[i][j + 1].parent_i = i;
-                cellDetails[i][j + 1].parent_j = j;
-                printf("The destination cell is found\n");
-                return tracePath(cellDetails, dest);
-                foundDest = true;
-            }
-
-            // If the successor is already on the closed
-            // list or if it is blocked, then ignore it.
-            // Else do the following
-            else if (closedList[i][j + 1] == false
-                     && !graph.isObstacle(i, j + 1)) {
-                gNew = cellDetails[i][j].g + 1.0;
-                hNew = calculateHValue(i, j + 1, dest);
-                fNew = gNew + hNew;
-
-                // If it isn’t on the open list, add it to
-                // the open list. Make the current square
-                // the parent of this square. Record the
-                // f, g, and h costs of the square cell
-                //                OR
-                // If it is on the open list already, check
-                // to see if this path to that square is
-                // better, using 'f' cost as the measure.
-                if (cellDetails[i][j + 1].f == FLT_MAX
-                    || cellDetails[i][j + 1].f > fNew) {
-                    openList.insert(make_pair(
-                        fNew, make_pair(i, j + 1)));
-
-                    // Update the details of this cell
-                    cellDetails[i][j + 1].f = fNew;
-                    cellDetails[i][j + 1].g = gNew;
-                    cellDetails[i][j + 1].h = hNew;
-                    cellDetails[i][j + 1].parent_i = i;
-                    cellDetails[i][j + 1].parent_j = j;
-                }
-            }
+        const int id = graph.toIndex(row, col);
+        if (id == goalId) {
+            return id;
         }
 
-        //----------- 4th Successor (West) ------------
-
-        // Only process this cell if this is a valid one
-        if (isValid(i, j - 1) == true) {
-            // If the destination cell is the same as the
-            // current successor
-            if (isDestination(i, j - 1, dest) == true) {
-                // Set the Parent of the destination cell
-                cellDetails[i][j - 1].parent_i = i;
-                cellDetails[i][j - 1].parent_j = j;
-                printf("The destination cell is found\n");
-                return tracePath(cellDetails, dest);
-                foundDest = true;
-            }
-
-            // If the successor is already on the closed
-            // list or if it is blocked, then ignore it.
-            // Else do the following
-            else if (closedList[i][j - 1] == false
-                     && !graph.isObstacle(i, j - 1)) {
-                gNew = cellDetails[i][j].g + 1.0;
-                hNew = calculateHValue(i, j - 1, dest);
-                fNew = gNew + hNew;
-
-                // If it isn’t on the open list, add it to
-                // the open list. Make the current square
-                // the parent of this square. Record the
-                // f, g, and h costs of the square cell
-                //                OR
-                // If it is on the open list already, check
-                // to see if this path to that square is
-                // better, using 'f' cost as the measure.
-                if (cellDetails[i][j - 1].f == FLT_MAX
-                    || cellDetails[i][j - 1].f > fNew) {
-                    openList.insert(make_pair(
-                        fNew, make_pair(i, j - 1)));
-
-                    // Update the details of this cell
-                    cellDetails[i][j - 1].f = fNew;
-                    cellDetails[i][j - 1].g = gNew;
-                    cellDetails[i][j - 1].h = hNew;
-                    cellDetails[i][j - 1].parent_i = i;
-                    cellDetails[i][j - 1].parent_j = j;
+        if (diagonal) {
+            if (dRow != 0 && dCol != 0) {
+                if ((isOpen(graph, blockingMask, row + dRow, col - dCol) && !isOpen(graph, blockingMask, row, col - dCol))
+                    || (isOpen(graph, blockingMask, row - dRow, col + dCol) && !isOpen(graph, blockingMask, row - dRow, col))) {
+                    return id;
+                }
+                if (jump(row, col, 0, dCol, goalId, true) != -1 || jump(row, col, dRow, 0, goalId, true) != -1) {
+                    return id;
                 }
+            } else if (dCol != 0) {
+                if ((isOpen(graph, blockingMask, row + 1, col + dCol) && !isOpen(graph, blockingMask, row + 1, col))
+                    || (isOpen(graph, blockingMask, row - 1, col + dCol) && !isOpen(graph, blockingMask, row - 1, col))) {
+                    return id;
+                }
+            } else {
+                if ((isOpen(graph, blockingMask, row + dRow, col + 1) && !isOpen(graph, blockingMask, row, col + 1))
+                    || (isOpen(graph, blockingMask, row + dRow, col - 1) && !isOpen(graph, blockingMask, row, col - 1))) {
+                    return id;
+                }
+            }
+        } else if (dCol != 0) {
+            if ((isOpen(graph, blockingMask, row - 1, col) && !isOpen(graph, blockingMask, row - 1, col - dCol))
+                || (isOpen(graph, blockingMask, row + 1, col) && !isOpen(graph, blockingMask, row + 1, col - dCol))) {
+                return id;
+            }
+        } else {
+            if ((isOpen(graph, blockingMask, row, col - 1) && !isOpen(graph, blockingMask, row - dRow, col - 1))
+                || (isOpen(graph, blockingMask, row, col + 1) && !isOpen(graph, blockingMask, row - dRow, col + 1))) {
+                return id;
+            }
+            if (jump(row, col, 0, 1, goalId, false) != -1 || jump(row, col, 0, -1, goalId, false) != -1) {
+                return id;
             }
         }
+    }
+}
 
-        //----------- 5th Successor (North-East)
-        //------------
-
-        // Only process this cell if this is a valid one
-        if (isValid(i - 1, j + 1) == true) {
-            // If the destination cell is the same as the
-            // current successor
-            if (isDestination(i - 1, j + 1, dest) == true) {
-                // Set the Parent of the destination cell
-                cellDetails[i - 1][j + 1].parent_i = i;
-                cellDetails[i - 1][j + 1].parent_j = j;
-                printf("The destination cell is found\n");
-                return tracePath(cellDetails, dest);
-                foundDest = true;
-            }
-
-            // If the successor is already on the closed
-            // list or if it is blocked, then ignore it.
-            // Else do the following
-            else if (closedList[i - 1][j + 1] == false
-                     && !graph.isObstacle(i - 1, j + 1)) {
-                gNew = cellDetails[i][j].g + 1.414;
-                hNew = calculateHValue(i - 1, j + 1, dest);
-                fNew = gNew + hNew;
-
-                // If it isn’t on the open list, add it to
-                // the open list. Make the current square
-                // the parent of this square. Record the
-                // f, g, and h costs of the square cell
-                //                OR
-                // If it is on the open list already, check
-                // to see if this path to that square is
-                // better, using 'f' cost as the measure.
-                if (cellDetails[i - 1][j + 1].f == FLT_MAX
-                    || cellDetails[i - 1][j + 1].f > fNew) {
-                    openList.insert(make_pair(
-                        fNew, make_pair(i - 1, j + 1)));
-
-                    // Update the details of this cell
-                    cellDetails[i - 1][j + 1].f = fNew;
-                    cellDetails[i - 1][j + 1].g = gNew;
-                    cellDetails[i - 1][j + 1].h = hNew;
-                    cellDetails[i - 1][j + 1].parent_i = i;
-                    cellDetails[i - 1][j + 1].parent_j = j;
-                }
-            }
+/**
+ * @brief A* entre puntos de salto: cada nodo expandido solo genera las direcciones podadas según la
+ * dirección por la que se llegó a él.
+ */
+bool Pathfinder::searchJumpPoints(const Position src, const Position dest, const bool diagonal) {
+    const int cols = graph.getCols();
+    const int startId = graph.toIndex(src.row, src.column);
+    const int goalId = graph.toIndex(dest.row, dest.column);
+    auto heuristic = [&](const int row, const int col) {
+        return diagonal ? octileDistance(row, col, dest)
+                        : STRAIGHT_COST * (abs(row - dest.row) + abs(col - dest.column));
+    };
+
+    workspace.begin(graph.getRows() * cols);
+    IndexedPriorityQueue<long long>& open = workspace.open;
+    workspace.visit(startId, -1, 0);
+    open.pushOrDecrease(startId, aStarKey(0, heuristic(src.row, src.column)));
+
+    expandedNodes = 0;
+    while (!open.empty()) {
+        const int id = open.pop();
+        ++expandedNodes;
+        if (id == goalId) {
+            return true;
         }
 
-        //----------- 6th Successor (North-West)
-        //------------
-
-        // Only process this cell if this is a valid one
-        if (isValid(i - 1, j - 1) == true) {
-            // If the destination cell is the same as the
-            // current successor
-            if (isDestination(i - 1, j - 1, dest) == true) {
-                // Set the Parent of the destination cell
-                cellDetails[i - 1][j - 1].parent_i = i;
-                cellDetails[i - 1][j - 1].parent_j = j;
-                printf("The destination cell is found\n");
-                return tracePath(cellDetails, dest);
-                foundDest = true;
-            }
-
-            // If the successor is already on the closed
-            // list or if it is blocked, then ignore it.
-            // Else do the following
-            else if (closedList[i - 1][j - 1] == false
-                     && !graph.isObstacle(i - 1, j - 1)) {
-                gNew = cellDetails[i][j].g + 1.414;
-                hNew = calculateHValue(i - 1, j - 1, dest);
-                fNew = gNew + hNew;
-
-                // If it isn’t on the open list, add it to
-                // the open list. Make the current square
-                // the parent of this square. Record the
-                // f, g, and h costs of the square cell
-                //                OR
-                // If it is on the open list already, check
-                // to see if this path to that square is
-                // better, using 'f' cost as the measure.
-                if (cellDetails[i - 1][j - 1].f == FLT_MAX
-                    || cellDetails[i - 1][j - 1].f > fNew) {
-                    openList.insert(make_pair(
-                        fNew, make_pair(i - 1, j - 1)));
-                    // Update the details of this cell
-                    cellDetails[i - 1][j - 1].f = fNew;
-                    cellDetails[i - 1][j - 1].g = gNew;
-                    cellDetails[i - 1][j - 1].h = hNew;
-                    cellDetails[i - 1][j - 1].parent_i = i;
-                    cellDetails[i - 1][j - 1].parent_j = j;
+        const int row = id / cols;
+        const int col = id % cols;
+        const int g = workspace.getDistance(id);
+
+        // Direcciones a explorar: todas desde el origen; si no, las naturales y las forzadas
+        int directions[OCTILE_COUNT][2];
+        int directionCount = 0;
+        auto addDirection = [&](const int dRow, const int dCol) {
+            directions[directionCount][0] = dRow;
+            directions[directionCount][1] = dCol;
+            ++directionCount;
+        };
+
+        const int parent = workspace.getParent(id);
+        if (parent == -1) {
+            for (int direction = 0; direction < (diagonal ? OCTILE_COUNT : GridGraph::NEIGHBOR_COUNT); ++direction) {
+                addDirection(OCTILE_ROW_OFFSETS[direction], OCTILE_COL_OFFSETS[direction]);
+            }
+        } else {
+            const int dRow = (row > parent / cols) - (row < parent / cols);
+            const int dCol = (col > parent % cols) - (col < parent % cols);
+            if (!diagonal) {
+                addDirection(dRow, dCol);
+                if (dCol != 0) {
+                    addDirection(-1, 0);
+                    addDirection(1, 0);
+                } else {
+                    addDirection(0, -1);
+                    addDirection(0, 1);
+                }
+            } else if (dRow != 0 && dCol != 0) {
+                addDirection(dRow, 0);
+                addDirection(0, dCol);
+                addDirection(dRow, dCol);
+                if (!isOpen(graph, blockingMask, row, col - dCol)) {
+                    addDirection(dRow, -dCol);
+                }
+                if (!isOpen(graph, blockingMask, row - dRow, col)) {
+                    addDirection(-dRow, dCol);
+                }
+            } else if (dCol != 0) {
+                addDirection(0, dCol);
+                if (!isOpen(graph, blockingMask, row + 1, col)) {
+                    addDirection(1, dCol);
+                }
+                if (!isOpen(graph, blockingMask, row - 1, col)) {
+                    addDirection(-1, dCol);
+                }
+            } else {
+                addDirection(dRow, 0);
+                if (!isOpen(graph, blockingMask, row, col + 1)) {
+                    addDirection(dRow, 1);
+                }
+                if (!isOpen(graph, blockingMask, row, col - 1)) {
+                    addDirection(dRow, -1);
                 }
             }
         }
 
-        //----------- 7th Successor (South-East)
-        //------------
-
-        // Only process this cell if this is a valid one
-        if (isValid(i + 1, j + 1) == true) {
-            // If the destination cell is the same as the
-            // current successor
-            if (isDestination(i + 1, j + 1, dest) == true) {
-                // Set the Parent of the destination cell
-                cellDetails[i + 1][j + 1].parent_i = i;
-                cellDetails[i + 1][j + 1].parent_j = j;
-                printf("The destination cell is found\n");
-                return tracePath(cellDetails, dest);
-                foundDest = true;
-            }
-
-            // If the successor is already on the closed
-            // list or if it is blocked, then ignore it.
-            // Else do the following
-            else if (closedList[i + 1][j + 1] == false
-                     && !graph.isObstacle(i + 1, j + 1)) {
-                gNew = cellDetails[i][j].g + 1.414;
-                hNew = calculateHValue(i + 1, j + 1, dest);
-                fNew = gNew + hNew;
-
-                // If it isn’t on the open list, add it to
-                // the open list. Make the current square
-                // the parent of this square. Record the
-                // f, g, and h costs of the square cell
-                //                OR
-                // If it is on the open list already, check
-                // to see if this path to that square is
-                // better, using 'f' cost as the measure.
-                if (cellDetails[i + 1][j + 1].f == FLT_MAX
-                    || cellDetails[i + 1][j + 1].f > fNew) {
-                    openList.insert(make_pair(
-                        fNew, make_pair(i + 1, j + 1)));
-
-                    // Update the details of this cell
-                    cellDetails[i + 1][j + 1].f = fNew;
-                    cellDetails[i + 1][j + 1].g = gNew;
-                    cellDetails[i + 1][j + 1].h = hNew;
-                    cellDetails[i + 1][j + 1].parent_i = i;
-                    cellDetails[i + 1][j + 1].parent_j = j;
-                }
+        for (int i = 0; i < directionCount; ++i) {
+            const int jumpId = jump(row, col, directions[i][0], directions[i][1], goalId, diagonal);
+            if (jumpId == -1) {
+                continue;
             }
-        }
 
-        //----------- 8th Successor (South-West)
-        //------------
-
-        // Only process this cell if this is a valid one
-        if (isValid(i + 1, j - 1) == true) {
-            // If the destination cell is the same as the
-            // current successor
-            if (isDestination(i + 1, j - 1, dest) == true) {
-                // Set the Parent of the destination cell
-                cellDetails[i + 1][j - 1].parent_i = i;
-                cellDetails[i + 1][j - 1].parent_j = j;
-                printf("The destination cell is found\n");
-                return tracePath(cellDetails, dest);
-                foundDest = true;
-            }
-
-            // If the successor is already on the closed
-            // list or if it is blocked, then ignore it.
-            // Else do the following
-            else if (closedList[i + 1][j - 1] == false
-                     && !graph.isObstacle(i + 1, j - 1)) {
-                gNew = cellDetails[i][j].g + 1.414;
-                hNew = calculateHValue(i + 1, j - 1, dest);
-                fNew = gNew + hNew;
-
-                // If it isn’t on the open list, add it to
-                // the open list. Make the current square
-                // the parent of this square. Record the
-                // f, g, and h costs of the square cell
-                //                OR
-                // If it is on the open list already, check
-                // to see if this path to that square is
-                // better, using 'f' cost as the measure.
-                if (cellDetails[i + 1][j - 1].f == FLT_MAX
-                    || cellDetails[i + 1][j - 1].f > fNew) {
-                    openList.insert(make_pair(
-                        fNew, make_pair(i + 1, j - 1)));
-
-                    // Update the details of this cell
-                    cellDetails[i + 1][j - 1].f = fNew;
-                    cellDetails[i + 1][j - 1].g = gNew;
-                    cellDetails[i + 1][j - 1].h = hNew;
-                    cellDetails[i + 1][j - 1].parent_i = i;
-                    cellDetails[i + 1][j - 1].parent_j = j;
-                }
+            const int jumpRow = jumpId / cols;
+            const int jumpCol = jumpId % cols;
+            const int steps = max(abs(jumpRow - row), abs(jumpCol - col));
+            const int nextG = g + steps * (directions[i][0] != 0 && directions[i][1] != 0 ? DIAGONAL_COST : STRAIGHT_COST);
+            if (nextG < workspace.getDistance(jumpId)) {
+                workspace.visit(jumpId, id, nextG);
+                open.pushOrDecrease(jumpId, aStarKey(nextG, heuristic(jumpRow, jumpCol)));
             }
         }
     }
 
-    // When the destination cell is not found and the open
-    // list is empty, then we conclude that we failed to
-    // reach the destination cell. This may happen when the
-    // there is no way to destination cell (due to
-    // blockages)
-    if (foundDest == false)
-        printf("Failed to find the Destination Cell\n");
-
-    return nullptr;
+    return false;
 }
 
-LinkedList<Position>* Pathfinder::calculateBulletPath(Position start, Position end, int maxBounces) const {
-    auto* path = new LinkedList<Position>();
-
-    int bounces = 0;
+Path Pathfinder::jumpPointSearch(const Position src, const Position dest, const Bitboard* blocked) {
+    // El destino solo cuenta con la máscara si no es el propio origen
+    if (!isOpen(graph, nullptr, src.row, src.column) || !isOpen(graph, src == dest ? nullptr : blocked, dest.row, dest.column)) {
+        return {};
+    }
 
-    double x = start.column + 0.5;
-    double y = start.row + 0.5;
+    // Las componentes son 4-conexas: si difieren no hay camino
+    if (!graph.areConnected(graph.toIndex(src.row, src.column), graph.toIndex(dest.row, dest.column))) {
+        return {};
+    }
 
-    double dx = end.column - start.column;
-    double dy = end.row - start.row;
+    // El origen puede estar en la máscara (el propio tanque); verlo como obstáculo solo añade puntos de salto
+    blockingMask = blocked;
+    if (!searchJumpPoints(src, dest, false)) {
+        return {};
+    }
+    Path path;
+    appendJumpPath(workspace, graph.getCols(), graph.toIndex(dest.row, dest.column), true, path);
+    return path;
+}
 
-    // Normalizar el vector de dirección
-    double length = sqrt(dx * dx + dy * dy);
-    dx /= length;
-    dy /= length;
+bool Pathfinder::searchJumpPointsDiagonal(const Position src, const Position dest, const Bitboard* blocked) {
+    if (!isOpen(graph, nullptr, src.row, src.column) || !isOpen(graph, blocked, dest.row, dest.column) || src == dest) {
+        return false;
+    }
 
-    int gridX = static_cast<int>(x);
-    int gridY = static_cast<int>(y);
+    blockingMask = blocked;
+    return searchJumpPoints(src, dest, true);
+}
 
-    path->append(Position{gridY, gridX});
+Path Pathfinder::jumpPointSearchDiagonal(const Position src, const Position dest, const Bitboard* blocked) {
+    Path path;
+    if (searchJumpPointsDiagonal(src, dest, blocked)) {
+        appendJumpPath(workspace, graph.getCols(), graph.toIndex(dest.row, dest.column), false, path);
+    }
+    return path;
+}
 
-    while (bounces <= maxBounces) {
-        x += dx;
-        y += dy;
+Path Pathfinder::calculateBulletPath(const Position start, const Position end, const int maxBounces) const {
+    Path path;
+    calculateBulletPath(start, end, maxBounces, path);
+    return path;
+}
 
-        int newGridX = static_cast<int>(x);
-        int newGridY = static_cast<int>(y);
+/**
+ * @brief Recorre la cuadrícula con el rayo de la bala (Amanatides–Woo) y rebota en paredes y bordes.
+ *
+ * El rayo sale del centro de la celda inicial hacia el centro de la celda objetivo. Con t medido en
+ * unidades de 1 / (2·|dx|·|dy|), cruzar una columna cuesta 2·|dy| y una fila 2·|dx|, así que los
+ * cruces se comparan con enteros exactos: se visita cada celda atravesada, una sola vez y en orden.
+ *
+ * Un rebote es el cruce que se descarta: si la celda siguiente es un obstáculo o está fuera del mapa,
+ * se invierte el paso de ese eje y su próximo cruce queda una celda más allá, sin entrar en la pared.
+ * Si el rayo pasa justo por una esquina, entra en la celda diagonal solo cuando las tres celdas que
+ * la rodean están libres; si alguna está bloqueada rebota en el eje que corresponda, de modo que
+ * nunca se cuela entre dos paredes en diagonal.
+ */
+void Pathfinder::calculateBulletPath(const Position start, const Position end, const int maxBounces, Path& path) const {
+    path.clear();
+    const long long dx = end.column - start.column;
+    const long long dy = end.row - start.row;
+    if (dx == 0 && dy == 0) {
+        return;
+    }
 
-        // Verificar si cambió de celda en la cuadrícula
-        if (newGridX != gridX || newGridY != gridY) {
-            gridX = newGridX;
-            gridY = newGridY;
+    auto blocked = [this](const int row, const int col) {
+        return !graph.isValid(row, col) || graph.isObstacle(row, col);
+    };
+
+    // Un eje sin movimiento no se cruza nunca
+    constexpr long long NEVER = std::numeric_limits<long long>::max();
+    const long long deltaX = 2 * std::abs(dy);
+    const long long deltaY = 2 * std::abs(dx);
+    long long nextX = dx != 0 ? std::abs(dy) : NEVER;
+    long long nextY = dy != 0 ? std::abs(dx) : NEVER;
+    int stepX = dx > 0 ? 1 : -1;
+    int stepY = dy > 0 ? 1 : -1;
+    int row = start.row;
+    int col = start.column;
+    int bounces = 0;
 
-            // Verificar límites del mapa
-            if (!GridGraph::isValid(gridY, gridX)) {
-                // Reflexionar dirección
-                if (gridX < 0 || gridX >= graph.getCols()) {
-                    dx = -dx;
-                    x += 2 * dx;
-                    bounces++;
-                }
-                if (gridY < 0 || gridY >= graph.getRows()) {
-                    dy = -dy;
-                    y += 2 * dy;
-                    bounces++;
-                }
-                if (bounces > maxBounces) {
-                    break;
-                }
-                continue;
+    path.push_back(start);
+    while (true) {
+        bool reflectX = false;
+        bool reflectY = false;
+        if (nextX < nextY) {
+            reflectX = blocked(row, col + stepX);
+            if (!reflectX) {
+                col += stepX;
+                nextX += deltaX;
             }
-
-            Position pos{gridY, gridX};
-            path->append(pos);
-
-            // Verificar colisión con obstáculo
-            if (graph.isObstacle(gridY, gridX)) {
-                // Reflexionar dirección
-                double prevX = x - dx;
-                double prevY = y - dy;
-
-                int prevGridX = static_cast<int>(prevX);
-                int prevGridY = static_cast<int>(prevY);
-
-                if (gridX != prevGridX && gridY != prevGridY) {
-                    // Colisión diagonal, reflexionar ambos ejes
-                    dx = -dx;
-                    dy = -dy;
-                } else if (gridX != prevGridX) {
-                    dx = -dx;
-                } else if (gridY != prevGridY) {
-                    dy = -dy;
-                }
-                bounces++;
-
-                if (bounces > maxBounces) {
-                    break;
-                }
-
-                // Ajustar posición para evitar bucles
-                x += dx;
-                y += dy;
-                continue;
+        } else if (nextY < nextX) {
+            reflectY = blocked(row + stepY, col);
+            if (!reflectY) {
+                row += stepY;
+                nextY += deltaY;
+            }
+        } else {
+            const bool sideX = blocked(row, col + stepX);
+            const bool sideY = blocked(row + stepY, col);
+            if (!sideX && !sideY && !blocked(row + stepY, col + stepX)) {
+                row += stepY;
+                col += stepX;
+                nextX += deltaX;
+                nextY += deltaY;
+            } else {
+                // Pared a un lado: rebota en ese eje; esquina (ambos lados o solo la diagonal): rebota en los dos
+                reflectX = sideX || !sideY;
+                reflectY = sideY || !sideX;
             }
+        }
 
-            // Verificar colisión con tanque
-            if (graph.isOccupied(gridY, gridX)) {
-                // La bala golpea un tanque
+        if (reflectX || reflectY) {
+            if (reflectX) {
+                stepX = -stepX;
+                nextX += deltaX;
+            }
+            if (reflectY) {
+                stepY = -stepY;
+                nextY += deltaY;
+            }
+            if (++bounces > maxBounces) {
                 break;
             }
+            continue;
         }
-    }
 
-    return path;
+        path.push_back(Position{row, col});
+
+        // La bala se detiene en el primer tanque que atraviesa
+        if (graph.isOccupied(row, col)) {
+            break;
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "TestSupport.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+namespace {
+    /**
+     * @brief Primer tramo recto del trazado anterior de las balas: un punto que avanza en pasos de longitud 1.
+     *
+     * Es la parte de la versión en coma flotante anterior a su primer rebote; termina al salir del mapa o
+     * al entrar en un obstáculo o un tanque.
+     */
+    std::vector<Position> legacyFirstRun(const GridGraph& map, const Position start, const Position end) {
+        double x = start.column + 0.5;
+        double y = start.row + 0.5;
+        double dx = end.column - start.column;
+        double dy = end.row - start.row;
+        const double length = std::sqrt(dx * dx + dy * dy);
+        dx /= length;
+        dy /= length;
+
+        std::vector<Position> run{start};
+        int gridX = start.column;
+        int gridY = start.row;
+        while (true) {
+            x += dx;
+            y += dy;
+            const int newGridX = static_cast<int>(x);
+            const int newGridY = static_cast<int>(y);
+            if (newGridX == gridX && newGridY == gridY) {
+                continue;
+            }
+            gridX = newGridX;
+            gridY = newGridY;
+            if (x < 0 || y < 0 || !map.isValid(gridY, gridX) || map.isObstacle(gridY, gridX)) {
+                return run;
+            }
+            run.push_back(Position{gridY, gridX});
+            if (map.isOccupied(gridY, gridX)) {
+                return run;
+            }
+        }
+    }
+
+    /**
+     * @brief Verifica si una celda detiene la bala como una pared (fuera del mapa u obstáculo).
+     */
+    bool wall(const GridGraph& map, const int row, const int col) {
+        return !map.isValid(row, col) || map.isObstacle(row, col);
+    }
+
+    /**
+     * @brief Comprueba las reglas de movimiento de un trazado: pasos a celdas vecinas libres, sin colarse
+     * en diagonal entre dos paredes y sin atravesar tanques.
+     */
+    void checkTrace(const GridGraph& map, const Path& path, const Position start) {
+        CHECK(!path.empty());
+        if (path.empty()) {
+            return;
+        }
+        CHECK(path[0] == start);
+        for (int i = 1; i < path.size(); ++i) {
+            const Position from = path[i - 1];
+            const Position to = path[i];
+            const int dRow = std::abs(to.row - from.row);
+            const int dCol = std::abs(to.column - from.column);
+            CHECK(dRow <= 1 && dCol <= 1 && dRow + dCol > 0);
+            CHECK(!wall(map, to.row, to.column));
+            if (dRow == 1 && dCol == 1) {
+                CHECK(!wall(map, from.row, to.column) && !wall(map, to.row, from.column));
+            }
+            if (map.isOccupied(to.row, to.column)) {
+                CHECK(i == path.size() - 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Verifica si a es una subsecuencia de b (mismas celdas en el mismo orden, con huecos).
+     */
+    bool isSubsequence(const std::vector<Position>& a, const Path& b) {
+        int next = 0;
+        for (int i = 0; i < b.size() && next < static_cast<int>(a.size()); ++i) {
+            if (b[i] == a[next]) {
+                ++next;
+            }
+        }
+        return next == static_cast<int>(a.size());
+    }
+}
+
+/**
+ * @brief Valida el trazado de las balas: reglas de movimiento en mapas con paredes y tanques, y coincidencia
+ * con el trazado anterior en el primer tramo sobre mapas abiertos.
+ */
+int main() {
+    constexpr int MAX_BOUNCES = 4;
+    struct Size {
+        int rows;
+        int cols;
+    };
+    constexpr Size SIZES[] = {{5, 5}, {13, 25}, {44, 64}};
+
+    std::mt19937 rng(7);
+    Path path;
+    for (const auto& [rows, cols] : SIZES) {
+        std::uniform_int_distribution<int> rowDist(0, rows - 1);
+        std::uniform_int_distribution<int> colDist(0, cols - 1);
+
+        // Mapas con paredes y tanques: solo reglas de movimiento
+        for (const double density : {0.1, 0.3}) {
+            GridGraph map(rows, cols);
+            TEST::scatterObstacles(map, density, rng);
+            for (int i = 0; i < rows * cols / 10; ++i) {
+                const int row = rowDist(rng);
+                const int col = colDist(rng);
+                if (!map.isObstacle(row, col) && !map.isOccupied(row, col)) {
+                    map.placeTank(row, col);
+                }
+            }
+
+            Pathfinder pathfinder(map);
+            for (int ray = 0; ray < 3000; ++ray) {
+                const Position start{rowDist(rng), colDist(rng)};
+                const Position end{rowDist(rng), colDist(rng)};
+                if (map.isObstacle(start.row, start.column)) {
+                    continue;
+                }
+                pathfinder.calculateBulletPath(start, end, MAX_BOUNCES, path);
+                if (start == end) {
+                    CHECK(path.empty());
+                } else {
+                    checkTrace(map, path, start);
+                }
+            }
+        }
+
+        // Mapa abierto: el primer tramo anterior recorre celdas del nuevo trazado, en el mismo orden
+        GridGraph open(rows, cols);
+        Pathfinder pathfinder(open);
+        for (int ray = 0; ray < 3000; ++ray) {
+            const Position start{rowDist(rng), colDist(rng)};
+            const Position end{rowDist(rng), colDist(rng)};
+            if (start == end) {
+                continue;
+            }
+            pathfinder.calculateBulletPath(start, end, MAX_BOUNCES, path);
+            checkTrace(open, path, start);
+
+            const std::vector<Position> legacy = legacyFirstRun(open, start, end);
+            CHECK(isSubsequence(legacy, path));
+
+            // En horizontal, vertical y a 45 grados el trazado anterior no se salta celdas: coinciden exactamente
+            const int dRow = std::abs(end.row - start.row);
+            const int dCol = std::abs(end.column - start.column);
+            if (dRow == 0 || dCol == 0 || dRow == dCol) {
+                CHECK(path.size() >= static_cast<int>(legacy.size()));
+                for (int i = 0; i < static_cast<int>(legacy.size()) && i < path.size(); ++i) {
+                    CHECK(path[i] == legacy[i]);
+                }
+            }
+        }
+    }
+
+    return TEST::result();
+}
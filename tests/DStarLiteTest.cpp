@@ -0,0 +1,158 @@
+#include <cstdlib>
+#include <queue>
+#include <random>
+#include <vector>
+#include "TestSupport.h"
+#include "systems/DStarLite.h"
+#include "systems/GridGraph.h"
+
+namespace {
+    /**
+     * @brief BFS 4-conexa de referencia que trata como bloqueadas las celdas con obstáculo o con tanque,
+     * salvo la de inicio, igual que DStarLite.
+     * @return Número de pasos del camino más corto, o -1 si no existe.
+     */
+    int referenceSteps(const GridGraph& map, const Position start, const Position goal) {
+        constexpr int ROW_OFFSETS[] = {-1, 1, 0, 0};
+        constexpr int COL_OFFSETS[] = {0, 0, 1, -1};
+        const int cols = map.getCols();
+        std::vector<int> distance(map.getRows() * cols, -1);
+        std::queue<int> queue;
+        distance[map.toIndex(start.row, start.column)] = 0;
+        queue.push(map.toIndex(start.row, start.column));
+        while (!queue.empty()) {
+            const int id = queue.front();
+            queue.pop();
+            if (id == map.toIndex(goal.row, goal.column)) {
+                return distance[id];
+            }
+            for (int direction = 0; direction < 4; ++direction) {
+                const int row = id / cols + ROW_OFFSETS[direction];
+                const int col = id % cols + COL_OFFSETS[direction];
+                if (map.isValid(row, col) && !map.isObstacle(row, col) && !map.isOccupied(row, col)
+                    && distance[row * cols + col] == -1) {
+                    distance[row * cols + col] = distance[id] + 1;
+                    queue.push(row * cols + col);
+                }
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Compara el camino reparado con la BFS de referencia y comprueba que es un camino válido.
+     */
+    void checkPath(const GridGraph& map, DStarLite& planner, const Position start, const Position goal) {
+        const Path path = planner.getPath();
+        const int expected = referenceSteps(map, start, goal);
+        CHECK(path.empty() == (expected == -1));
+        if (path.empty() || expected == -1) {
+            return;
+        }
+
+        CHECK(path.size() - 1 == expected);
+        CHECK(path[0] == start);
+        CHECK(path.back() == goal);
+        for (int i = 1; i < path.size(); ++i) {
+            CHECK(std::abs(path[i].row - path[i - 1].row) + std::abs(path[i].column - path[i - 1].column) == 1);
+            CHECK(!map.isObstacle(path[i].row, path[i].column) && !map.isOccupied(path[i].row, path[i].column));
+        }
+    }
+
+    /**
+     * @brief Devuelve una celda libre (sin obstáculo ni tanque) al azar.
+     */
+    Position randomFreeCell(const GridGraph& map, std::mt19937& rng) {
+        std::uniform_int_distribution<int> rowDist(0, map.getRows() - 1);
+        std::uniform_int_distribution<int> colDist(0, map.getCols() - 1);
+        while (true) {
+            const Position cell{rowDist(rng), colDist(rng)};
+            if (!map.isObstacle(cell.row, cell.column) && !map.isOccupied(cell.row, cell.column)) {
+                return cell;
+            }
+        }
+    }
+
+    /**
+     * @brief Mueve un tanque de una celda a otra y avisa al planificador de las dos celdas, como Model::moveTank().
+     */
+    void moveTank(GridGraph& map, DStarLite& planner, const Position from, const Position to) {
+        map.removeTank(from.row, from.column);
+        map.placeTank(to.row, to.column);
+        planner.cellChanged(from.row, from.column);
+        planner.cellChanged(to.row, to.column);
+    }
+
+    /**
+     * @brief Recorre varios planes con cambios aleatorios de paredes y tanques entre cada paso del tanque.
+     */
+    void runScenario(const int rows, const int cols, const double density, std::mt19937& rng) {
+        constexpr int TANKS = 6;
+        constexpr int PLANS = 15;
+        constexpr int STEPS = 25;
+        constexpr int CHANGES_PER_STEP = 3;
+
+        GridGraph map(rows, cols);
+        TEST::scatterObstacles(map, density, rng);
+        std::vector<Position> tanks;
+        for (int i = 0; i < TANKS; ++i) {
+            tanks.push_back(randomFreeCell(map, rng));
+            map.placeTank(tanks.back().row, tanks.back().column);
+        }
+
+        DStarLite planner(map);
+        std::uniform_int_distribution<int> rowDist(0, rows - 1);
+        std::uniform_int_distribution<int> colDist(0, cols - 1);
+        std::uniform_int_distribution<int> tankDist(1, TANKS - 1);
+        for (int plan = 0; plan < PLANS; ++plan) {
+            // El tanque 0 es el que se mueve; el destino es cualquier celda libre
+            const Position goal = randomFreeCell(map, rng);
+            planner.plan(tanks[0], goal);
+            checkPath(map, planner, tanks[0], goal);
+
+            for (int step = 0; step < STEPS; ++step) {
+                for (int change = 0; change < CHANGES_PER_STEP; ++change) {
+                    if (change % 2 == 0) {
+                        // Tapiar o abrir una celda sin tanque
+                        const Position cell{rowDist(rng), colDist(rng)};
+                        if (!map.isOccupied(cell.row, cell.column)) {
+                            map.setNodeAccessibility(cell.row, cell.column, map.isObstacle(cell.row, cell.column));
+                            planner.cellChanged(cell.row, cell.column);
+                        }
+                    } else {
+                        // Mover otro tanque a una celda libre cualquiera
+                        Position& tank = tanks[tankDist(rng)];
+                        const Position to = randomFreeCell(map, rng);
+                        moveTank(map, planner, tank, to);
+                        tank = to;
+                    }
+                }
+                checkPath(map, planner, tanks[0], goal);
+
+                // El tanque avanza un paso por el camino reparado, si lo hay
+                const Path path = planner.getPath();
+                if (path.size() < 2) {
+                    break;
+                }
+                moveTank(map, planner, tanks[0], path[1]);
+                tanks[0] = path[1];
+                planner.moveStart(tanks[0]);
+                checkPath(map, planner, tanks[0], goal);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Valida D* Lite: cada camino reparado tras cambios de paredes y tanques tiene la longitud de una BFS nueva.
+ */
+int main() {
+    std::mt19937 rng(7);
+    for (int scenario = 0; scenario < 10; ++scenario) {
+        runScenario(13, 25, 0.15, rng);
+        runScenario(30, 40, 0.25, rng);
+        runScenario(64, 64, 0.3, rng);
+    }
+
+    return TEST::result();
+}
@@ -0,0 +1,159 @@
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+#include "TestSupport.h"
+#include "systems/GridGraph.h"
+#include "systems/Pathfinder.h"
+
+using namespace DATA_STRUCTURES;
+
+namespace {
+    /**
+     * @brief Verifica si la búsqueda puede entrar en una celda: dentro del mapa, sin obstáculo y fuera de la máscara.
+     */
+    bool enterable(const GridGraph& map, const Bitboard* blocked, const int row, const int col) {
+        return map.isValid(row, col) && !map.isObstacle(row, col) && !(blocked && blocked->test(row, col));
+    }
+
+    /**
+     * @brief Dijkstra 8-conexo de referencia con los costes y las reglas de movimiento de Pathfinder::aStar().
+     * @return Coste del camino más barato, o -1 si no existe.
+     */
+    int referenceOctileCost(const GridGraph& map, const Position src, const Position dest, const Bitboard* blocked) {
+        if (!enterable(map, nullptr, src.row, src.column) || !enterable(map, blocked, dest.row, dest.column)
+            || src == dest) {
+            return -1;
+        }
+
+        const int cols = map.getCols();
+        std::vector<int> cost(map.getRows() * cols, -1);
+        using Entry = std::pair<int, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> open;
+        open.emplace(0, map.toIndex(src.row, src.column));
+        while (!open.empty()) {
+            const auto [g, id] = open.top();
+            open.pop();
+            if (cost[id] != -1) {
+                continue;
+            }
+            cost[id] = g;
+            for (int dRow = -1; dRow <= 1; ++dRow) {
+                for (int dCol = -1; dCol <= 1; ++dCol) {
+                    const int row = id / cols + dRow;
+                    const int col = id % cols + dCol;
+                    if ((dRow != 0 || dCol != 0) && enterable(map, blocked, row, col) && cost[row * cols + col] == -1) {
+                        const int step = dRow != 0 && dCol != 0 ? Pathfinder::DIAGONAL_COST : Pathfinder::STRAIGHT_COST;
+                        open.emplace(g + step, row * cols + col);
+                    }
+                }
+            }
+        }
+        return cost[map.toIndex(dest.row, dest.column)];
+    }
+
+    /**
+     * @brief Comprueba que un camino 4-conexo en el formato de bfs() es válido y devuelve su número de pasos.
+     */
+    int checkCardinalPath(const GridGraph& map, const Path& path, const Position src, const Position dest,
+                          const Bitboard* blocked) {
+        CHECK(path[0] == src);
+        CHECK(path.back() == dest);
+        for (int i = 1; i < path.size(); ++i) {
+            CHECK(std::abs(path[i].row - path[i - 1].row) + std::abs(path[i].column - path[i - 1].column) == 1);
+            CHECK(enterable(map, blocked, path[i].row, path[i].column));
+        }
+        return path.size() - 1;
+    }
+
+    /**
+     * @brief Comprueba que un camino 8-conexo en el formato de aStar() es válido y devuelve su coste.
+     */
+    int checkOctilePath(const GridGraph& map, const Path& path, const Position src, const Position dest,
+                        const Bitboard* blocked) {
+        CHECK(path.back() == dest);
+        int cost = 0;
+        Position previous = src;
+        for (int i = 0; i < path.size(); ++i) {
+            const int dRow = std::abs(path[i].row - previous.row);
+            const int dCol = std::abs(path[i].column - previous.column);
+            CHECK(dRow <= 1 && dCol <= 1 && dRow + dCol > 0);
+            CHECK(enterable(map, blocked, path[i].row, path[i].column));
+            cost += dRow + dCol == 2 ? Pathfinder::DIAGONAL_COST : Pathfinder::STRAIGHT_COST;
+            previous = path[i];
+        }
+        return cost;
+    }
+
+    /**
+     * @brief Compara JPS4 con bfs() y JPS8 con la referencia 8-conexa en pares aleatorios de un mapa.
+     *
+     * El mapa necesita al menos una celda accesible.
+     */
+    void comparePairs(GridGraph& map, const Bitboard* blocked, std::mt19937& rng, const int pairs) {
+        Pathfinder pathfinder(map);
+        std::uniform_int_distribution<int> rowDist(0, map.getRows() - 1);
+        std::uniform_int_distribution<int> colDist(0, map.getCols() - 1);
+        for (int i = 0; i < pairs; ++i) {
+            // El origen es siempre la celda de un tanque; el destino puede ser cualquier celda
+            Position src{rowDist(rng), colDist(rng)};
+            while (map.isObstacle(src.row, src.column)) {
+                src = {rowDist(rng), colDist(rng)};
+            }
+            const Position dest = i % 20 == 0 ? src : Position{rowDist(rng), colDist(rng)};
+
+            const Path bfs = pathfinder.bfs(src, dest, blocked);
+            const Path jps4 = pathfinder.jumpPointSearch(src, dest, blocked);
+            CHECK(jps4.empty() == bfs.empty());
+            if (!jps4.empty() && !bfs.empty()) {
+                CHECK(checkCardinalPath(map, jps4, src, dest, blocked) == bfs.size() - 1);
+            }
+
+            const int expected = referenceOctileCost(map, src, dest, blocked);
+            const Path jps8 = pathfinder.jumpPointSearchDiagonal(src, dest, blocked);
+            const Path aStar = pathfinder.aStar(src, dest, blocked);
+            CHECK(jps8.empty() == (expected == -1));
+            CHECK(aStar.empty() == (expected == -1));
+            if (!jps8.empty() && expected != -1) {
+                CHECK(checkOctilePath(map, jps8, src, dest, blocked) == expected);
+            }
+            if (!aStar.empty() && expected != -1) {
+                CHECK(checkOctilePath(map, aStar, src, dest, blocked) == expected);
+            }
+            CHECK(pathfinder.findPath(PathAlgorithm::JumpPointDiagonal, src, dest, blocked).size() == jps8.size());
+        }
+    }
+}
+
+/**
+ * @brief Valida Jump Point Search: JPS4 frente a BFS y JPS8 frente a Dijkstra 8-conexo, con y sin máscara.
+ */
+int main() {
+    struct Size {
+        int rows;
+        int cols;
+    };
+    constexpr Size SIZES[] = {{13, 25}, {40, 60}, {97, 131}};
+    constexpr double DENSITIES[] = {0.0, 0.1, 0.25, 0.4};
+
+    std::mt19937 rng(7);
+    for (const auto& [rows, cols] : SIZES) {
+        for (const double density : DENSITIES) {
+            GridGraph map(rows, cols);
+            TEST::scatterObstacles(map, density, rng);
+            comparePairs(map, nullptr, rng, 300);
+
+            const Bitboard mask = TEST::randomMask(map, 0.05, rng);
+            comparePairs(map, &mask, rng, 300);
+        }
+
+        // Mapas del juego, con sus zonas seguras y relleno de áreas abiertas
+        GridGraph generated(rows, cols);
+        generated.generateObstacles(rows * cols);
+        comparePairs(generated, nullptr, rng, 300);
+        comparePairs(generated, &generated.getOccupiedBoard(), rng, 300);
+    }
+
+    return TEST::result();
+}
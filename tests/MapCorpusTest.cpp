@@ -0,0 +1,152 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "TestSupport.h"
+#include "systems/GridGraph.h"
+#include "systems/MapCorpus.h"
+
+namespace {
+    /**
+     * @brief Ruta de un archivo temporal de la prueba.
+     */
+    std::string tempPath(const char* name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    /**
+     * @brief Lee un archivo completo como bytes.
+     */
+    std::vector<char> readBytes(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    /**
+     * @brief Escribe bytes en un archivo, sustituyendo su contenido.
+     */
+    void writeBytes(const std::string& path, const std::vector<char>& bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    /**
+     * @brief Verifica si abrir el archivo lanza std::runtime_error.
+     */
+    bool rejects(const std::string& path) {
+        try {
+            MapCorpus corpus(path);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Escribe una colección de mapas generados con semillas consecutivas y la compara, celda a celda
+     * y en sus metadatos, con los mismos mapas regenerados a partir de cada semilla.
+     */
+    void checkRoundTrip(const int rows, const int cols, const int count) {
+        const std::string path = tempPath("MapCorpusTest.tamc");
+        {
+            MapCorpusWriter writer(path, rows, cols);
+            GridGraph map(rows, cols);
+            for (int i = 0; i < count; ++i) {
+                map.generateObstacles(1000 + i);
+                writer.append(map, 1000 + i);
+            }
+            writer.close();
+        }
+
+        const MapCorpus corpus(path);
+        CHECK(corpus.getRows() == rows);
+        CHECK(corpus.getCols() == cols);
+        CHECK(corpus.getMapCount() == count);
+
+        GridGraph expected(rows, cols);
+        GridGraph loaded(rows, cols);
+        for (int i = 0; i < count; ++i) {
+            expected.generateObstacles(1000 + i);
+            const MapView view = corpus.getMap(i);
+            CHECK(view.getSeed() == static_cast<unsigned int>(1000 + i));
+            CHECK(view.getComponentCount() == expected.getComponentCount());
+            CHECK(view.getChokepointCount() == expected.getChokepoints().size());
+
+            int obstacles = 0;
+            view.loadInto(loaded);
+            for (int row = 0; row < rows; ++row) {
+                for (int col = 0; col < cols; ++col) {
+                    obstacles += expected.isObstacle(row, col);
+                    CHECK(view.isObstacle(row, col) == expected.isObstacle(row, col));
+                    CHECK(view.isSafeNode(row, col) == expected.isSafeNode(row * cols + col));
+                    CHECK(loaded.isObstacle(row, col) == expected.isObstacle(row, col));
+                }
+            }
+            CHECK(view.getObstacleCount() == obstacles);
+            CHECK(loaded.getFreeCellCount() == expected.getFreeCellCount());
+        }
+
+        bool outOfRange = false;
+        try {
+            static_cast<void>(corpus.getMap(count));
+        } catch (const std::out_of_range&) {
+            outOfRange = true;
+        }
+        CHECK(outOfRange);
+
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Comprueba que se rechazan archivos con firma o versión incorrectas, o truncados.
+     */
+    void checkRejection() {
+        const std::string path = tempPath("MapCorpusTest.tamc");
+        const std::string corrupted = tempPath("MapCorpusTest-corrupted.tamc");
+        {
+            MapCorpusWriter writer(path, 13, 25);
+            GridGraph map(13, 25);
+            for (int i = 0; i < 3; ++i) {
+                map.generateObstacles(i);
+                writer.append(map, i);
+            }
+        }
+        const std::vector<char> bytes = readBytes(path);
+        CHECK(!rejects(path));
+
+        std::vector<char> badMagic = bytes;
+        badMagic[0] = 'X';
+        writeBytes(corrupted, badMagic);
+        CHECK(rejects(corrupted));
+
+        std::vector<char> badVersion = bytes;
+        badVersion[4] = static_cast<char>(MapFormat::VERSION + 1);
+        writeBytes(corrupted, badVersion);
+        CHECK(rejects(corrupted));
+
+        // Sin el último byte del último registro, y con la cabecera incompleta
+        writeBytes(corrupted, std::vector<char>(bytes.begin(), bytes.end() - 1));
+        CHECK(rejects(corrupted));
+        writeBytes(corrupted, std::vector<char>(bytes.begin(), bytes.begin() + MapFormat::HEADER_SIZE - 1));
+        CHECK(rejects(corrupted));
+
+        CHECK(rejects(tempPath("MapCorpusTest-missing.tamc")));
+
+        std::filesystem::remove(path);
+        std::filesystem::remove(corrupted);
+    }
+}
+
+/**
+ * @brief Valida MapCorpus: lo que escribe MapCorpusWriter se lee igual que los mapas de generateObstacles(seed),
+ * y los archivos dañados se rechazan al abrirlos.
+ */
+int main() {
+    checkRoundTrip(13, 25, 8);
+    checkRoundTrip(30, 41, 5);
+    checkRejection();
+
+    return TEST::result();
+}
@@ -0,0 +1,79 @@
+#ifndef TESTSUPPORT_H
+#define TESTSUPPORT_H
+
+#include <cstdio>
+#include <random>
+#include "data_structures/Bitboard.h"
+#include "systems/GridGraph.h"
+
+/**
+ * @brief Utilidades de las pruebas de los sistemas.
+ *
+ * Cada prueba es un ejecutable que compara un sistema con una implementación de referencia sobre mapas
+ * aleatorios de semilla fija; CHECK informa de cada discrepancia y main devuelve TEST::result().
+ */
+namespace TEST {
+    inline int failures = 0; ///< Número de comprobaciones fallidas.
+
+    /**
+     * @brief Registra una comprobación fallida con su ubicación.
+     */
+    inline void fail(const char* file, const int line, const char* condition) {
+        ++failures;
+        std::fprintf(stderr, "%s:%d: falló %s\n", file, line, condition);
+    }
+
+    /**
+     * @brief Código de salida de la prueba: 0 si todas las comprobaciones pasaron.
+     */
+    inline int result() {
+        if (failures > 0) {
+            std::fprintf(stderr, "%d comprobaciones fallidas\n", failures);
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Construye un mapa sin tanques con obstáculos independientes de probabilidad density.
+     *
+     * A diferencia de GridGraph::generateObstacles(), deja celdas aisladas y pasillos en diagonal, que son
+     * los casos difíciles para las búsquedas.
+     */
+    inline void scatterObstacles(GridGraph& map, const double density, std::mt19937& rng) {
+        std::bernoulli_distribution obstacle(density);
+        for (int row = 0; row < map.getRows(); ++row) {
+            for (int col = 0; col < map.getCols(); ++col) {
+                map.setNodeAccessibility(row, col, !obstacle(rng));
+            }
+        }
+    }
+
+    /**
+     * @brief Construye una máscara de bloqueo del tamaño del mapa con celdas de probabilidad density.
+     */
+    inline DATA_STRUCTURES::Bitboard randomMask(const GridGraph& map, const double density, std::mt19937& rng) {
+        DATA_STRUCTURES::Bitboard mask(map.getRows(), map.getCols());
+        std::bernoulli_distribution blocked(density);
+        for (int row = 0; row < map.getRows(); ++row) {
+            for (int col = 0; col < map.getCols(); ++col) {
+                if (blocked(rng)) {
+                    mask.set(row, col);
+                }
+            }
+        }
+        return mask;
+    }
+}
+
+/**
+ * @brief Comprueba una condición; si falla, la informa y la prueba termina con error sin detenerse.
+ */
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            TEST::fail(__FILE__, __LINE__, #condition); \
+        } \
+    } while (false)
+
+#endif // TESTSUPPORT_H